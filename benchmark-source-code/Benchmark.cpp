@@ -0,0 +1,229 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+// Every allocation in the program goes through these, so that they can be counted
+static atomic<long long> numAllocations{0};
+
+void* operator new(size_t size)
+{
+    numAllocations.fetch_add(1, memory_order_relaxed);
+
+    if (auto memory = malloc(size == 0 ? 1 : size))
+        return memory;
+
+    throw bad_alloc{};
+}
+
+void operator delete(void* memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    free(memory);
+}
+
+volatile char Benchmark::sink_ = 0;
+
+Benchmark::Benchmark(int numSamples, double sampleSeconds):
+    numSamples_{max(1, numSamples)},
+    sampleSeconds_{sampleSeconds}
+{
+}
+
+void Benchmark::add(const string& name, body run)
+{
+    cases_.push_back({name, run});
+}
+
+vector<Benchmark::Result> Benchmark::run(const string& filter) const
+{
+    auto results = vector<Result>{};
+
+    for (auto& benchmark : cases_)
+    {
+        if (benchmark.name.find(filter) == string::npos)
+            continue;
+
+        auto result = measure(benchmark);
+
+        cout << left << setw(32) << result.name << right << fixed << setprecision(1)
+             << setw(14) << result.nsPerOp << " ns/op"
+             << "  +/- " << setw(8) << result.madNsPerOp
+             << setprecision(2) << setw(12) << result.allocsPerOp << " allocs/op" << endl;
+
+        results.push_back(result);
+    }
+
+    return results;
+}
+
+bool Benchmark::writeJson(const string& filePath, const vector<Result>& results)
+{
+    ofstream file{filePath};
+
+    if (!file)
+        return false;
+
+    file << "{\"benchmarks\":[";
+    file << fixed << setprecision(2);
+
+    for (auto i = 0u; i < results.size(); i++)
+    {
+        auto& result = results[i];
+
+        file << (i == 0 ? "\n" : ",\n")
+             << "{\"name\":\"" << result.name << "\""
+             << ",\"ns_per_op\":" << result.nsPerOp
+             << ",\"mad_ns_per_op\":" << result.madNsPerOp
+             << ",\"min_ns_per_op\":" << result.minNsPerOp
+             << ",\"allocs_per_op\":" << result.allocsPerOp
+             << ",\"iterations\":" << result.iterations
+             << ",\"samples\":" << result.samples << "}";
+    }
+
+    file << "\n]}\n";
+
+    return static_cast<bool>(file);
+}
+
+bool Benchmark::readJson(const string& filePath, vector<Result>& results)
+{
+    ifstream file{filePath};
+
+    if (!file)
+        return false;
+
+    results.clear();
+
+    // Only the layout written by writeJson() needs to be understood: one benchmark per line
+    auto getField = [](const string& line, const string& key) -> string
+    {
+        auto start = line.find("\"" + key + "\":");
+        if (start == string::npos)
+            return "";
+
+        start += key.size() + 3;
+        if (line[start] == '"')
+            return line.substr(start + 1, line.find('"', start + 1) - start - 1);
+
+        return line.substr(start, line.find_first_of(",}", start) - start);
+    };
+
+    auto line = string{};
+    while (getline(file, line))
+    {
+        auto name = getField(line, "name");
+        if (name.empty())
+            continue;
+
+        auto result = Result{};
+        result.name = name;
+        result.nsPerOp = atof(getField(line, "ns_per_op").c_str());
+        result.madNsPerOp = atof(getField(line, "mad_ns_per_op").c_str());
+        result.minNsPerOp = atof(getField(line, "min_ns_per_op").c_str());
+        result.allocsPerOp = atof(getField(line, "allocs_per_op").c_str());
+        result.iterations = atoll(getField(line, "iterations").c_str());
+        result.samples = atoi(getField(line, "samples").c_str());
+
+        results.push_back(result);
+    }
+
+    return true;
+}
+
+vector<string> Benchmark::findRegressions(const vector<Result>& baseline, const vector<Result>& results, double tolerance)
+{
+    auto regressions = vector<string>{};
+
+    for (auto& result : results)
+    {
+        auto old = find_if(baseline.begin(), baseline.end(), [&](const Result& r){return r.name == result.name;});
+        if (old == baseline.end())
+            continue;
+
+        auto noise = 3*max(old->madNsPerOp, result.madNsPerOp);
+        auto increase = result.nsPerOp - old->nsPerOp;
+
+        if (old->nsPerOp > 0 && increase > tolerance*old->nsPerOp && increase > noise)
+        {
+            auto message = ostringstream{};
+            message << fixed << setprecision(1) << result.name << ": " << old->nsPerOp << " -> " << result.nsPerOp
+                    << " ns/op (+" << 100*increase/old->nsPerOp << "%)";
+            regressions.push_back(message.str());
+        }
+
+        // Allocations are counted rather than timed, so any real increase is a regression
+        if (result.allocsPerOp > old->allocsPerOp + 0.01)
+        {
+            auto message = ostringstream{};
+            message << fixed << setprecision(2) << result.name << ": " << old->allocsPerOp << " -> " << result.allocsPerOp << " allocs/op";
+            regressions.push_back(message.str());
+        }
+    }
+
+    return regressions;
+}
+
+long long Benchmark::getNumAllocations()
+{
+    return numAllocations.load(memory_order_relaxed);
+}
+
+/*------------- Private helper functions -------------*/
+
+Benchmark::Result Benchmark::measure(const Case& benchmark) const
+{
+    // Find how many iterations fill a sample, which also warms up the caches
+    auto iterations = 1LL;
+    while (time(benchmark.run, iterations) < sampleSeconds_ && iterations < (1LL << 40))
+        iterations *= 2;
+
+    auto nsPerOp = vector<double>{};
+    auto allocationsBefore = getNumAllocations();
+
+    for (auto sample = 0; sample < numSamples_; sample++)
+        nsPerOp.push_back(1e9*time(benchmark.run, iterations)/iterations);
+
+    auto allocations = getNumAllocations() - allocationsBefore;
+
+    auto median = [](vector<double> values)
+    {
+        sort(values.begin(), values.end());
+        auto middle = values.size()/2;
+        return values.size() % 2 ? values[middle] : (values[middle - 1] + values[middle])/2;
+    };
+
+    auto result = Result{};
+    result.name = benchmark.name;
+    result.nsPerOp = median(nsPerOp);
+    result.minNsPerOp = *min_element(nsPerOp.begin(), nsPerOp.end());
+    result.allocsPerOp = static_cast<double>(allocations)/(iterations*numSamples_);
+    result.iterations = iterations;
+    result.samples = numSamples_;
+
+    auto deviations = vector<double>{};
+    for (auto value : nsPerOp)
+        deviations.push_back(fabs(value - result.nsPerOp));
+    result.madNsPerOp = median(deviations);
+
+    return result;
+}
+
+double Benchmark::time(const body& run, long long iterations)
+{
+    auto start = chrono::steady_clock::now();
+    run(iterations);
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
@@ -0,0 +1,100 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/// \file Benchmark.h
+/// \brief Contains the class definition for the "Benchmark" class, which times the game's hot paths
+
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/// \class Benchmark
+/// \brief A set of micro-benchmarks, each timed over many samples so that the results are not thrown by noise
+///
+/// Each benchmark is first run with more and more iterations until one run takes long enough to time reliably, which also warms up the caches. It is then timed over a number of samples of that many iterations. The median time of the samples is reported, together with the median absolute deviation (MAD) as a measure of how noisy it was, since neither is moved much by the odd sample that is interrupted by the operating system. Every allocation made while the samples run is counted, so the number of allocations per operation is reported as well.
+///
+/// The results can be saved to a JSON baseline, with one benchmark per line so that a change to the baseline reads clearly in a diff, and later results can be compared against it to find regressions.
+
+class Benchmark
+{
+public:
+    typedef function<void(long long)> body; /**\typedef a function which runs the operation being timed a given number of times */
+
+    /// \struct The timing of one benchmark
+    struct Result
+    {
+        string name;
+        double nsPerOp = 0;         // median over the samples
+        double madNsPerOp = 0;      // median absolute deviation of the samples from the median
+        double minNsPerOp = 0;      // the fastest sample
+        double allocsPerOp = 0;     // calls to operator new, averaged over every iteration of every sample
+        long long iterations = 0;   // iterations in each sample
+        int samples = 0;
+    };
+
+    /// Constructor
+    /// @param numSamples the number of timed samples of each benchmark
+    /// @param sampleSeconds the least time that a sample should take, which sets the number of iterations in a sample
+    Benchmark(int numSamples = 15, double sampleSeconds = 0.02);
+
+    /// Add a benchmark to the set
+    /// @param name the name of the benchmark, which identifies it in the baseline
+    /// @param run a function that runs the operation the number of times it is given
+    void add(const string& name, body run);
+
+    /// Run the benchmarks, in the order in which they were added
+    /// @param filter only benchmarks whose names contain this text are run
+    /// \return the results of the benchmarks that were run
+    vector<Result> run(const string& filter = "") const;
+
+    /// Write results to a JSON file
+    /// @param filePath the path of the file
+    /// @param results the results to write
+    /// \return true if the file was written, and false otherwise
+    static bool writeJson(const string& filePath, const vector<Result>& results);
+
+    /// Read results from a JSON file written by writeJson()
+    /// @param filePath the path of the file
+    /// @param results filled with the results in the file
+    /// \return true if the file was read, and false otherwise
+    static bool readJson(const string& filePath, vector<Result>& results);
+
+    /// Find the benchmarks which have become slower or allocate more than in a baseline
+    ///
+    /// A benchmark is only slower if its median has grown by more than the tolerance and also by more than three times the larger MAD, so that a noisy benchmark is not reported just for being noisy. Benchmarks which are not in the baseline are ignored.
+    /// @param baseline the results to compare against
+    /// @param results the new results
+    /// @param tolerance the fraction by which a benchmark may slow down before it is reported
+    /// \return a description of each regression
+    static vector<string> findRegressions(const vector<Result>& baseline, const vector<Result>& results, double tolerance = 0.1);
+
+    /// Get the number of calls to operator new made by the program so far
+    /// \return the number of allocations
+    static long long getNumAllocations();
+
+    /// Stop the compiler from optimising away the calculation of a value that is otherwise unused
+    /// @param value the value to keep
+    template <typename T>
+    static void keep(const T& value) {sink_ = *reinterpret_cast<const volatile char*>(&value);}
+
+private:
+    struct Case
+    {
+        string name;
+        body run;
+    };
+
+    int numSamples_;
+    double sampleSeconds_;
+    vector<Case> cases_;
+
+    static volatile char sink_;
+
+    // Private helper functions
+    Result measure(const Case& benchmark) const;
+    static double time(const body& run, long long iterations);
+};
+
+#endif
@@ -0,0 +1,339 @@
+/// \file Benchmarks.cpp
+/// \brief Micro-benchmarks of the game's hot paths: building the maze, looking up tiles, moving characters, enemy targeting and a whole level update
+///
+/// Usage: Benchmarks [--filter text] [--samples n] [--baseline file] [--save file]
+///
+/// --filter runs only the benchmarks whose names contain the text, --save writes the results as a JSON baseline, and --baseline compares the results against a saved baseline and exits with a failure if any benchmark has regressed. Like the tests, it must be run from the directory that contains the game's resources.
+
+#include <SFML/Graphics.hpp>
+
+#include "Benchmark.h"
+
+#include "../game-source-code/Configuration.h"
+#include "../game-source-code/AssetManager.h"
+#include "../game-source-code/Maze.h"
+#include "../game-source-code/Player.h"
+#include "../game-source-code/Blinky.h"
+#include "../game-source-code/Pinky.h"
+#include "../game-source-code/Inky.h"
+#include "../game-source-code/Clyde.h"
+#include "../game-source-code/DefaultCharacterState.h"
+#include "../game-source-code/EnemyChaseState.h"
+#include "../game-source-code/EnemyRoster.h"
+#include "../game-source-code/Simulation.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// The movement functions are only available to the states, so these expose them
+class BenchmarkPlayerState : public DefaultCharacterState
+{
+public:
+    using DefaultCharacterState::DefaultCharacterState;
+    using PlayerMovingState::movePlayer;
+};
+
+class BenchmarkEnemyState : public EnemyChaseState
+{
+public:
+    using EnemyChaseState::EnemyChaseState;
+    using EnemyMovingState::findNextMove;
+};
+
+// Everything needed to build the Classic maze, loaded once
+struct MazeAssets
+{
+    Maze::Data data;
+    Maze::Textures textures;
+    Maze::Observers observers;
+    float tileLength = 36.0f;
+};
+
+MazeAssets loadMazeAssets()
+{
+    auto assetManager = AssetManager{};
+    auto mazeName = "Classic"s;
+
+    assetManager.loadLayout("layout", mazeName);
+    assetManager.loadRotationMap("rotation", mazeName);
+    assetManager.loadKeyMap("key map", mazeName);
+    assetManager.loadStartPos("startPos", mazeName);
+
+    assetManager.loadTexture("wall", WALL_FILEPATH);
+    assetManager.loadTexture("corner", CORNER_FILEPATH);
+    assetManager.loadTexture("gate", GATE_FILEPATH);
+    assetManager.loadTexture("broken gate", BROKEN_GATE_FILEPATH);
+    assetManager.loadTexture("key", KEY_FILEPATH);
+    assetManager.loadTexture("banana", BANANA_FILEPATH);
+    assetManager.loadTexture("power pellet", POWER_PELLET_FILEPATH);
+    assetManager.loadTexture("super pellet", SUPER_PELLET_FILEPATH);
+    assetManager.loadTexture("empty", EMPTY_FILEPATH);
+
+    auto assets = MazeAssets{};
+
+    assets.data.layout = assetManager.getLayout("layout");
+    assets.data.rotationMap = assetManager.getRotationMap("rotation");
+    assets.data.keyMap = assetManager.getKeyMap("key map");
+    assets.data.startPos = assetManager.getStartPos("startPos");
+
+    assets.textures.empty = assetManager.getTexture("empty");
+    assets.textures.wall = assetManager.getTexture("wall");
+    assets.textures.corner = assetManager.getTexture("corner");
+    assets.textures.gate = assetManager.getTexture("gate");
+    assets.textures.brokenGate = assetManager.getTexture("broken gate");
+    assets.textures.key = assetManager.getTexture("key");
+    assets.textures.fruit = assetManager.getTexture("banana");
+    assets.textures.powerPellet = assetManager.getTexture("power pellet");
+    assets.textures.superPellet = assetManager.getTexture("super pellet");
+
+    return assets;
+}
+
+Maze buildMaze(const MazeAssets& assets)
+{
+    return Maze{assets.data, assets.textures, assets.observers, sf::Vector2f{0,0}, assets.tileLength};
+}
+
+// A maze with a player and one enemy of each type in it, which must not move since they refer to each other
+struct Scene
+{
+    explicit Scene(const MazeAssets& assets):
+        maze{buildMaze(assets)},
+        player{Player::Clips{}, maze.getPlayerStart(), &maze},
+        runner{Player::Clips{}, maze.getPlayerStart(), &maze},
+        blinky{Enemy::Clips{}, maze.getEnemyStarts()[0], &player, &maze},
+        pinky{Enemy::Clips{}, maze.getEnemyStarts()[0], &player, &maze},
+        inky{Enemy::Clips{}, maze.getEnemyStarts()[0], &player, &maze, &blinky},
+        clyde{Enemy::Clips{}, maze.getEnemyStarts()[0], &player, &maze}
+    {
+    }
+
+    Scene(const Scene&) = delete;
+    Scene& operator=(const Scene&) = delete;
+
+    Maze maze;
+    Player player;
+    Player runner;  // moved by the movement benchmark, so that the other benchmarks do not depend on it
+    Blinky blinky;
+    Pinky pinky;
+    Inky inky;
+    Clyde clyde;
+};
+
+// A roster of many enemies, which take turns at each type and at each of the enemy starts, as in a level
+shared_ptr<EnemyRoster> makeSwarm(Scene& scene, int numEnemies)
+{
+    auto swarm = make_shared<EnemyRoster>();
+    auto starts = scene.maze.getEnemyStarts();
+    Enemy* blinky = nullptr;
+
+    for (auto i = 0; i < numEnemies; i++)
+    {
+        auto start = starts[i % starts.size()];
+
+        switch (i % 4)
+        {
+            case 0: blinky = &swarm->add(make_unique<Blinky>(Enemy::Clips{}, start, &scene.player, &scene.maze)); break;
+            case 1: swarm->add(make_unique<Pinky>(Enemy::Clips{}, start, &scene.player, &scene.maze)); break;
+            case 2: swarm->add(make_unique<Inky>(Enemy::Clips{}, start, &scene.player, &scene.maze, blinky)); break;
+            default: swarm->add(make_unique<Clyde>(Enemy::Clips{}, start, &scene.player, &scene.maze)); break;
+        }
+    }
+
+    return swarm;
+}
+
+// The centre of every tile in the maze, for looking tiles up
+vector<sf::Vector2f> getTileCentres(const Maze& maze)
+{
+    auto centres = vector<sf::Vector2f>{};
+    auto length = maze.getTileLength();
+
+    for (auto y = length/2; y < maze.getHeight(); y += length)
+    {
+        for (auto x = length/2; x < maze.getWidth(); x += length)
+            centres.push_back(sf::Vector2f{x,y});
+    }
+
+    return centres;
+}
+
+void addMazeBenchmarks(Benchmark& benchmark, const MazeAssets& assets, Scene& scene)
+{
+    benchmark.add("maze construction", [&](long long iterations)
+    {
+        for (auto i = 0LL; i < iterations; i++)
+        {
+            auto maze = buildMaze(assets);
+            Benchmark::keep(maze);
+        }
+    });
+
+    benchmark.add("maze getTileType", [&, centres = getTileCentres(scene.maze)](long long iterations)
+    {
+        auto numWalls = 0;
+        for (auto i = 0LL; i < iterations; i++)
+            numWalls += scene.maze.getTileType(centres[i % centres.size()]) == Maze::TileType::WALL;
+
+        Benchmark::keep(numWalls);
+    });
+
+    benchmark.add("maze getNodes", [&](long long iterations)
+    {
+        auto numNodes = 0u;
+        for (auto i = 0LL; i < iterations; i++)
+            numNodes += scene.maze.getNodes().size();
+
+        Benchmark::keep(numNodes);
+    });
+}
+
+void addCharacterBenchmarks(Benchmark& benchmark, Scene& scene)
+{
+    benchmark.add("player movePlayer", [&](long long iterations)
+    {
+        auto state = BenchmarkPlayerState{&scene.runner, &scene.maze};
+
+        // Keep turning, so that the player runs around the maze rather than stopping at a wall
+        for (auto i = 0LL; i < iterations; i++)
+        {
+            switch ((i/64) % 4)
+            {
+                case 0: scene.runner.Left(); break;
+                case 1: scene.runner.Up(); break;
+                case 2: scene.runner.Right(); break;
+                default: scene.runner.Down(); break;
+            }
+
+            state.movePlayer(MS_PER_FRAME, scene.runner.NormalSpeed(), &scene.runner, &scene.maze);
+        }
+
+        Benchmark::keep(scene.runner);
+    });
+
+    benchmark.add("enemy findNextMove", [&](long long iterations)
+    {
+        auto state = BenchmarkEnemyState{&scene.blinky, &scene.maze};
+        auto target = scene.player.getCurrentTile();
+
+        auto move = sf::Vector2f{};
+        for (auto i = 0LL; i < iterations; i++)
+            move += state.findNextMove(target);
+
+        Benchmark::keep(move);
+    });
+
+    benchmark.add("enemy roster update 200", [swarm = makeSwarm(scene, 200), profiler = make_shared<Profiler>(1)](long long iterations)
+    {
+        for (auto i = 0LL; i < iterations; i++)
+            swarm->update(MS_PER_FRAME, *profiler);
+
+        Benchmark::keep(*swarm);
+    });
+
+    auto addChaseTarget = [&](const string& name, Enemy& enemy)
+    {
+        benchmark.add(name + " getChaseTarget", [&enemy](long long iterations)
+        {
+            auto target = sf::Vector2f{};
+            for (auto i = 0LL; i < iterations; i++)
+                target += enemy.getChaseTarget();
+
+            Benchmark::keep(target);
+        });
+    };
+
+    addChaseTarget("blinky", scene.blinky);
+    addChaseTarget("pinky", scene.pinky);
+    addChaseTarget("inky", scene.inky);
+    addChaseTarget("clyde", scene.clyde);
+}
+
+void addLevelBenchmarks(Benchmark& benchmark)
+{
+    benchmark.add("level update tick", [](long long iterations)
+    {
+        static auto seed = 0u;
+        static auto simulation = make_unique<Simulation>("Classic", 1, seed);
+
+        const sf::Keyboard::Key keys[] = {sf::Keyboard::Up, sf::Keyboard::Down, sf::Keyboard::Left, sf::Keyboard::Right};
+
+        for (auto i = 0LL; i < iterations; i++)
+        {
+            // A new level is started if the last one ended, which is rare enough not to move the median
+            if (simulation->isOver())
+                simulation = make_unique<Simulation>("Classic", 1, ++seed);
+
+            if (simulation->getFrameCount() % static_cast<int>(FRAME_RATE) == 0)
+                simulation->pressKey(keys[(simulation->getFrameCount()/static_cast<int>(FRAME_RATE)) % 4]);
+
+            simulation->step();
+        }
+
+        Benchmark::keep(*simulation);
+    });
+}
+
+int main(int argc, char* argv[])
+{
+    auto filter = ""s;
+    auto baselinePath = ""s;
+    auto savePath = ""s;
+    auto numSamples = 15;
+
+    for (auto i = 1; i + 1 < argc; i += 2)
+    {
+        auto option = string{argv[i]};
+
+        if (option == "--filter")
+            filter = argv[i + 1];
+        else if (option == "--baseline")
+            baselinePath = argv[i + 1];
+        else if (option == "--save")
+            savePath = argv[i + 1];
+        else if (option == "--samples")
+            numSamples = atoi(argv[i + 1]);
+        else
+        {
+            cerr << "Unknown option " << option << endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto assets = loadMazeAssets();
+    auto scene = make_unique<Scene>(assets);
+
+    auto benchmark = Benchmark{numSamples};
+    addMazeBenchmarks(benchmark, assets, *scene);
+    addCharacterBenchmarks(benchmark, *scene);
+    addLevelBenchmarks(benchmark);
+
+    auto results = benchmark.run(filter);
+
+    if (!savePath.empty() && !Benchmark::writeJson(savePath, results))
+    {
+        cerr << "Could not write " << savePath << endl;
+        return EXIT_FAILURE;
+    }
+
+    if (baselinePath.empty())
+        return EXIT_SUCCESS;
+
+    auto baseline = vector<Benchmark::Result>{};
+    if (!Benchmark::readJson(baselinePath, baseline))
+    {
+        cerr << "Could not read " << baselinePath << endl;
+        return EXIT_FAILURE;
+    }
+
+    auto regressions = Benchmark::findRegressions(baseline, results);
+    for (auto& regression : regressions)
+        cout << "REGRESSION " << regression << endl;
+
+    return regressions.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,57 @@
+#include "Animator.h"
+
+Animator::clipPtr Animator::makeClip(texturePtr texture, sf::Vector2i frameSize, int row, float period)
+{
+    if (!texture)
+        return nullptr;
+
+    auto numFrames = static_cast<int>(texture->getSize().x) / frameSize.x;
+
+    if (numFrames == 0)
+        return nullptr;
+
+    auto clip = make_shared<AnimationClip>();
+    clip->texture = texture;
+    clip->origin = sf::Vector2f{static_cast<float>(frameSize.x/2), static_cast<float>(frameSize.y/2)};
+    clip->period = period;
+
+    for (auto frame = 0; frame < numFrames; frame++)
+        clip->frames.push_back(sf::IntRect(frame * frameSize.x, row * frameSize.y, frameSize.x, frameSize.y));
+
+    return clip;
+}
+
+void Animator::play(sf::Sprite& sprite, const clipPtr& clip, float dt)
+{
+    time_ += dt;
+
+    if (!clip)
+        return;
+
+    auto numFrames = clip->frames.size();
+    auto frame = static_cast<size_t>((time_/clip->period) * numFrames) % numFrames;
+
+    if (clip.get() != clip_)
+    {
+        sprite.setTexture(*clip->texture);
+        sprite.setOrigin(clip->origin);
+        sprite.setTextureRect(clip->frames[frame]);
+
+        clip_ = clip.get();
+        frame_ = frame;
+    }
+    else if (frame != frame_)
+    {
+        sprite.setTextureRect(clip->frames[frame]);
+        frame_ = frame;
+    }
+}
+
+void Animator::setScale(sf::Sprite& sprite, float scale)
+{
+    if (scale == scale_)
+        return;
+
+    sprite.setScale(scale, scale);
+    scale_ = scale;
+}
@@ -0,0 +1,63 @@
+#ifndef ANIMATOR_H
+#define ANIMATOR_H
+
+/// \file Animator.h
+/// \brief Contains the definitions of the "AnimationClip" struct and the "Animator" class
+
+#include <SFML/Graphics.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+/// \struct AnimationClip
+/// \brief One row of a sprite sheet, split into equally sized frames
+///
+/// Clips are immutable once they are made, so a single clip can be shared by any number of characters.
+struct AnimationClip
+{
+    shared_ptr<sf::Texture> texture;
+    vector<sf::IntRect> frames;
+    sf::Vector2f origin;    // centre of a frame
+    float period;           // milliseconds taken to play every frame once
+};
+
+/// \class Animator
+/// \brief Plays animation clips on a sprite
+///
+/// The frame to show is worked out from the total time that has been animated, so that changing clip does not restart the animation. The sprite is only changed when the clip, frame or scale actually changes, and playing a clip does not allocate.
+
+class Animator
+{
+public:
+    typedef shared_ptr<sf::Texture> texturePtr; /**\typedef a shared pointer to a sf::Texture, to improve readability */
+    typedef shared_ptr<const AnimationClip> clipPtr; /**\typedef a shared pointer to an immutable AnimationClip, to improve readability */
+
+    /// Make a clip from one row of a sprite sheet
+    /// @param texture the sprite sheet, whose width is a whole number of frames
+    /// @param frameSize the width and height of a frame in pixels
+    /// @param row the row of the sheet, counting from zero at the top
+    /// @param period the time taken to play every frame once, in milliseconds
+    /// \return the clip, or a null pointer if there is no texture (as in a headless game) or it holds no frames
+    static clipPtr makeClip(texturePtr texture, sf::Vector2i frameSize, int row, float period);
+
+    /// Advance the animation and show the current frame of a clip on the sprite
+    /// @param sprite the sprite to animate
+    /// @param clip the clip to play, which is ignored if it is null
+    /// @param dt the time that has passed since the last call, in milliseconds
+    void play(sf::Sprite& sprite, const clipPtr& clip, float dt);
+
+    /// Set the scale of the sprite, if it has changed
+    /// @param sprite the sprite to scale
+    /// @param scale the scale factor in both directions
+    void setScale(sf::Sprite& sprite, float scale);
+
+private:
+    const AnimationClip* clip_ = nullptr;
+    size_t frame_ = 0;
+    float scale_ = 0;
+    float time_ = 0;
+};
+
+#endif
@@ -0,0 +1,193 @@
+#include "AssetLoader.h"
+#include "AssetPack.h"
+
+#include <algorithm>
+
+AssetLoader::~AssetLoader()
+{
+    isStopping_ = true;
+
+    for (auto& worker : workers_)
+        worker.join();
+}
+
+void AssetLoader::addTexture(const string& name, const string& filePath)
+{
+    assets_.push_back(Asset{Type::TEXTURE, assetManager_.getTextureId(name), filePath});
+}
+
+void AssetLoader::addFont(const string& name, const string& filePath)
+{
+    assets_.push_back(Asset{Type::FONT, assetManager_.getFontId(name), filePath});
+}
+
+void AssetLoader::addSoundBuffer(Sound sound, const string& filePath)
+{
+    assets_.push_back(Asset{Type::SOUND_BUFFER, static_cast<int>(sound), filePath});
+}
+
+void AssetLoader::addMusic(Song song, const string& filePath)
+{
+    assets_.push_back(Asset{Type::MUSIC, static_cast<int>(song), filePath});
+}
+
+void AssetLoader::start(int numThreads)
+{
+    if (numThreads <= 0)
+        numThreads = max(1, static_cast<int>(thread::hardware_concurrency()) - 1);
+
+    for (auto i = 0; i < numThreads; i++)
+        workers_.emplace_back(&AssetLoader::work, this);
+}
+
+void AssetLoader::update(sf::Time budget)
+{
+    sf::Clock clock;
+
+    while (numLoaded_ < assets_.size())
+    {
+        size_t index;
+
+        {
+            lock_guard<mutex> guard{decodedLock_};
+
+            if (decoded_.empty())
+                return;
+
+            index = decoded_.front();
+            decoded_.pop();
+        }
+
+        addToManager(assets_[index]);
+        numLoaded_++;
+
+        if (clock.getElapsedTime() >= budget)
+            return;
+    }
+}
+
+float AssetLoader::getProgress() const
+{
+    if (assets_.empty())
+        return 1.0f;
+
+    return static_cast<float>(numLoaded_) / assets_.size();
+}
+
+bool AssetLoader::isFinished() const
+{
+    return numLoaded_ == assets_.size();
+}
+
+/*------------- Private helper functions -------------*/
+
+void AssetLoader::work()
+{
+    // Each worker claims the next undecoded asset until there are none left
+    while (!isStopping_)
+    {
+        auto index = nextToDecode_++;
+
+        if (index >= assets_.size())
+            return;
+
+        decode(assets_[index]);
+
+        lock_guard<mutex> guard{decodedLock_};
+        decoded_.push(index);
+    }
+}
+
+void AssetLoader::decode(Asset& asset)
+{
+    auto packed = AssetPack::getGamePack().find(asset.filePath);
+
+    switch (asset.type)
+    {
+    case Type::TEXTURE:
+        if (packed)
+            asset.isFailed = !asset.image.loadFromMemory(packed.data, packed.size);
+        else
+            asset.isFailed = !asset.image.loadFromFile(asset.filePath);
+        break;
+
+    case Type::FONT:
+        asset.font = make_shared<sf::Font>();
+        if (packed)
+            asset.isFailed = !asset.font->loadFromMemory(packed.data, packed.size);
+        else
+            asset.isFailed = !asset.font->loadFromFile(asset.filePath);
+        break;
+
+    case Type::SOUND_BUFFER:
+        {
+            sf::InputSoundFile file;
+
+            if (packed ? !file.openFromMemory(packed.data, packed.size) : !file.openFromFile(asset.filePath))
+            {
+                asset.isFailed = true;
+                break;
+            }
+
+            asset.samples.resize(file.getSampleCount());
+            asset.samples.resize(file.read(asset.samples.data(), asset.samples.size()));
+            asset.channelCount = file.getChannelCount();
+            asset.sampleRate = file.getSampleRate();
+        }
+        break;
+
+    case Type::MUSIC:
+        // Music is streamed, so there is nothing to decode up front
+        break;
+    }
+}
+
+void AssetLoader::addToManager(Asset& asset)
+{
+    // An asset that could not be decoded is left unloaded, rather than being stored empty
+    if (asset.isFailed)
+    {
+        assetManager_.reportFailure(asset.filePath);
+        asset.font.reset();
+        return;
+    }
+
+    switch (asset.type)
+    {
+    case Type::TEXTURE:
+        {
+            auto texture = make_shared<sf::Texture>();
+
+            if (texture->loadFromImage(asset.image))
+                assetManager_.addTexture(asset.id, texture);
+            else
+                assetManager_.reportFailure(asset.filePath);
+        }
+        break;
+
+    case Type::FONT:
+        assetManager_.addFont(asset.id, asset.font);
+        break;
+
+    case Type::SOUND_BUFFER:
+        {
+            auto buffer = make_shared<sf::SoundBuffer>();
+
+            if (!asset.samples.empty() &&
+                buffer->loadFromSamples(asset.samples.data(), asset.samples.size(), asset.channelCount, asset.sampleRate))
+                assetManager_.addSoundBuffer(static_cast<Sound>(asset.id), buffer);
+            else
+                assetManager_.reportFailure(asset.filePath);
+        }
+        break;
+
+    case Type::MUSIC:
+        assetManager_.loadMusic(static_cast<Song>(asset.id), asset.filePath);
+        break;
+    }
+
+    // The decoded data is no longer needed once the resource has been created
+    asset.image = sf::Image{};
+    asset.samples = vector<sf::Int16>{};
+    asset.font.reset();
+}
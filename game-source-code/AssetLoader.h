@@ -0,0 +1,115 @@
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+/// \file AssetLoader.h
+/// \brief Contains the class definition for the "AssetLoader" class
+
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+
+#include "AssetManager.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/// \class AssetLoader
+/// \brief Loads a batch of assets into the asset manager in the background
+///
+/// Loading is split in two. Decoding the files (PNG images, sound samples and fonts) is slow and thread-safe, so it is done by a pool of worker threads. Creating the SFML resources from the decoded data (uploading textures to the GPU, filling sound buffers and opening music streams) must happen on the main thread, so it is done in small time-budgeted chunks by calling update() once per frame. This keeps the window responsive and allows the actual progress to be shown while loading.
+
+class AssetLoader
+{
+public:
+    /// Constructor
+    /// @param assetManager the asset manager that the loaded assets are added to
+    AssetLoader(AssetManager& assetManager): assetManager_(assetManager) {}
+
+    /// Destructor
+    ///
+    /// Any assets that have not been decoded yet are abandoned, and the worker threads are stopped
+    ~AssetLoader();
+
+    /// Queue a texture to be loaded
+    /// @param name texture name
+    /// @param filePath relative path to texture
+    void addTexture(const string& name, const string& filePath);
+
+    /// Queue a font to be loaded
+    /// @param name font name
+    /// @param filePath relative path to font
+    void addFont(const string& name, const string& filePath);
+
+    /// Queue a sound buffer to be loaded
+    /// @param sound the sound effect
+    /// @param filePath relative path to sound buffer
+    void addSoundBuffer(Sound sound, const string& filePath);
+
+    /// Queue a song to be opened
+    /// @param song the song
+    /// @param filePath relative path to music file
+    void addMusic(Song song, const string& filePath);
+
+    /// Start decoding the queued assets in the background
+    ///
+    /// No more assets may be queued once loading has started
+    /// @param numThreads the number of worker threads to use, or 0 to use one less than the number of hardware threads
+    void start(int numThreads = 0);
+
+    /// Add decoded assets to the asset manager until the time budget has been used up
+    ///
+    /// This must be called from the main thread, since it creates the textures and sound buffers
+    /// @param budget the maximum time to spend (at least one asset is added if one is ready)
+    void update(sf::Time budget);
+
+    /// Get the fraction of the assets that have been completely loaded
+    /// \return a number between 0 and 1
+    float getProgress() const;
+
+    /// Check whether all of the assets have been loaded
+    /// \return true if loading is complete, and false otherwise
+    bool isFinished() const;
+
+private:
+    /// \enum The types of asset that can be loaded
+    enum class Type {TEXTURE, FONT, SOUND_BUFFER, MUSIC};
+
+    /// \struct An asset waiting to be loaded, along with its decoded data
+    struct Asset
+    {
+        Type type;
+        int id;             // the asset manager's id (or Sound/Song value) for the asset
+        string filePath;
+
+        sf::Image image;
+        shared_ptr<sf::Font> font;
+        vector<sf::Int16> samples;
+        unsigned int channelCount = 0;
+        unsigned int sampleRate = 0;
+        bool isFailed = false;  // set if the file could not be read or decoded
+    };
+
+    AssetManager& assetManager_;
+    vector<Asset> assets_;
+    size_t numLoaded_ = 0;
+
+    vector<thread> workers_;
+    atomic<size_t> nextToDecode_{0};
+    atomic<bool> isStopping_{false};
+
+    queue<size_t> decoded_;
+    mutex decodedLock_;
+
+    // Private helper functions
+    void work();
+    void decode(Asset& asset);
+    void addToManager(Asset& asset);
+};
+
+#endif
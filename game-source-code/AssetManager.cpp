@@ -1,4 +1,6 @@
 #include "AssetManager.h"
+#include "AssetPack.h"
+#include "MazeFile.h"
 #include <iostream>
 #include <string>
 #include <cstring>
@@ -6,90 +8,155 @@
 void AssetManager::loadTexture(const string& name, const string& filePath)
 {
     auto texture = make_shared<sf::Texture>();
+    auto packed = AssetPack::getGamePack().find(filePath);
 
-    if(!texture->loadFromFile(filePath))
+    if(packed ? !texture->loadFromMemory(packed.data, packed.size) : !texture->loadFromFile(filePath))
     {
-        // throw exception
+        reportFailure(filePath);
+        return;
     }
 
-    textures_[name] = texture;
+    addTexture(getTextureId(name), texture);
+}
+
+void AssetManager::addTexture(int id, texturePtr texture)
+{
+    textures_[id] = texture;
+}
+
+int AssetManager::getTextureId(const string& name)
+{
+    auto id = findId(textureIds_, name);
+
+    if (id == static_cast<int>(textures_.size()))
+        textures_.emplace_back();
+
+    return id;
+}
+
+AssetManager::texturePtr AssetManager::getTexture(int id) const
+{
+    return textures_[id];
 }
 
 AssetManager::texturePtr AssetManager::getTexture(const string& name)
 {
-    return textures_[name];
+    return textures_[getTextureId(name)];
 }
 
 void AssetManager::loadFont(const string& name, const string& filePath)
 {
     auto font = make_shared<sf::Font>();
+    auto packed = AssetPack::getGamePack().find(filePath);
 
-    if(!font->loadFromFile(filePath))
+    if(packed ? !font->loadFromMemory(packed.data, packed.size) : !font->loadFromFile(filePath))
     {
-        // throw exception
+        reportFailure(filePath);
+        return;
     }
 
-    fonts_[name] = font;
+    addFont(getFontId(name), font);
+}
+
+void AssetManager::addFont(int id, fontPtr font)
+{
+    fonts_[id] = font;
+}
+
+int AssetManager::getFontId(const string& name)
+{
+    auto id = findId(fontIds_, name);
+
+    if (id == static_cast<int>(fonts_.size()))
+        fonts_.emplace_back();
+
+    return id;
+}
+
+AssetManager::fontPtr AssetManager::getFont(int id) const
+{
+    return fonts_[id];
 }
 
 AssetManager::fontPtr AssetManager::getFont(const string& name)
 {
-    return fonts_[name];
+    return fonts_[getFontId(name)];
 }
 
-void AssetManager::loadSoundBuffer(const string& name, const string& filePath)
+void AssetManager::loadSoundBuffer(Sound sound, const string& filePath)
 {
     auto buffer = make_shared<sf::SoundBuffer>();
+    auto packed = AssetPack::getGamePack().find(filePath);
 
-    if(!buffer->loadFromFile(filePath))
+    if(packed ? !buffer->loadFromMemory(packed.data, packed.size) : !buffer->loadFromFile(filePath))
     {
-        // throw exception
+        reportFailure(filePath);
+        return;
     }
 
-    buffers_[name] = buffer;
-    sounds_[name].setBuffer(*buffers_[name]);
+    addSoundBuffer(sound, buffer);
 }
 
-void AssetManager::playSound(const string& name)
+void AssetManager::addSoundBuffer(Sound sound, bufferPtr buffer)
 {
-    sounds_[name].play();
+    auto index = static_cast<size_t>(sound);
+
+    buffers_[index] = buffer;
+    sounds_[index].setBuffer(*buffer);
 }
 
-void AssetManager::loadMusic(const string& name, const string& filePath)
+void AssetManager::playSound(Sound sound)
+{
+    auto index = static_cast<size_t>(sound);
+
+    if (buffers_[index])
+        sounds_[index].play();
+}
+
+void AssetManager::loadMusic(Song song, const string& filePath)
 {
     auto music_pointer = make_unique<sf::Music>();
+    auto packed = AssetPack::getGamePack().find(filePath);
 
-    if(!music_pointer->openFromFile(filePath))
+    if(packed ? !music_pointer->openFromMemory(packed.data, packed.size) : !music_pointer->openFromFile(filePath))
     {
-        // throw exception
+        reportFailure(filePath);
+        return;
     }
 
-    music_[name] = move(music_pointer);   // this might not work... I'm just guessing
+    music_[static_cast<size_t>(song)] = move(music_pointer);
 }
 
-void AssetManager::playSong(const string& name)
+void AssetManager::playSong(Song song)
 {
-    music_[name]->play();
+    if (auto music = findMusic(song))
+        music->play();
 }
 
-void AssetManager::pauseSong(const string& name)
+void AssetManager::pauseSong(Song song)
 {
-    music_[name]->pause();
+    if (auto music = findMusic(song))
+        music->pause();
 }
 
-void AssetManager::stopSong(const string& name)
+void AssetManager::stopSong(Song song)
 {
-    music_[name]->stop();
+    if (auto music = findMusic(song))
+        music->stop();
 }
 
-void AssetManager::setLoop(const string& name, bool isLoop)
+void AssetManager::setLoop(Song song, bool isLoop)
 {
-    music_[name]->setLoop(isLoop);
+    if (auto music = findMusic(song))
+        music->setLoop(isLoop);
 }
 
-sf::SoundSource::Status AssetManager::getStatus(const string& name)
+sf::SoundSource::Status AssetManager::getStatus(Song song)
 {
-    return music_[name]->getStatus();
+    if (auto music = findMusic(song))
+        return music->getStatus();
+
+    return sf::SoundSource::Status::Stopped;
 }
 
 
@@ -158,6 +225,33 @@ Maze::posKeyMap& AssetManager::getKeyMap(const string& name)
     return keyMaps_[name];
 }
 
+void AssetManager::loadMaze(const string& name, const string& mazeName)
+{
+    auto filePath = MAZE_DIRECTORY + mazeName + MAZE_FILE_EXTENSION;
+    MazeFile mazeFile;
+
+    if (MazeFile::isUpToDate(mazeName) && mazeFile.open(filePath))
+    {
+        mazes_[name] = mazeFile.getData();
+        return;
+    }
+
+    auto& mazeData = mazes_[name];
+    mazeData = Maze::Data{};
+
+    fileReader_.readFile(mazeData.layout, MAZE_DIRECTORY + mazeName + "_layout.txt");
+    fileReader_.readFile(mazeData.rotationMap, MAZE_DIRECTORY + mazeName + "_orientations.txt");
+    fileReader_.readFile(mazeData.keyMap, MAZE_DIRECTORY + mazeName + "_keymap.txt");
+    fileReader_.readFile(mazeData.startPos, MAZE_DIRECTORY + mazeName + "_startpositions.txt");
+
+    MazeFile::write(mazeData, filePath);
+}
+
+Maze::Data& AssetManager::getMaze(const string& name)
+{
+    return mazes_[name];
+}
+
 void AssetManager::loadStartPos(const string& name, const string& mazeName)
 {
     auto filePath = MAZE_DIRECTORY + mazeName + "_startpositions.txt";
@@ -182,6 +276,16 @@ vector<pair<string,int>>& AssetManager::getHighScores()
     return highScores_;
 }
 
+void AssetManager::loadReplay(const string& filePath)
+{
+    fileReader_.readFile(replay_, filePath);
+}
+
+Replay& AssetManager::getReplay()
+{
+    return replay_;
+}
+
 /*---------------------- Writing -----------------------*/
 void AssetManager::addMazeName(string& mazeName)
 {
@@ -200,6 +304,7 @@ void AssetManager::writeLayout(vector<string>& layout, const string& mazeName)
     auto filePath = MAZE_DIRECTORY + mazeName + "_layout.txt";
 
     fileWriter_.writeFile(layout, filePath);
+    removeMazeFile(mazeName);
 }
 
 void AssetManager::writeRotationMap(vector<string>& rotations, const string& mazeName)
@@ -207,6 +312,7 @@ void AssetManager::writeRotationMap(vector<string>& rotations, const string& maz
     auto filePath = MAZE_DIRECTORY + mazeName + "_orientations.txt";
 
     fileWriter_.writeFile(rotations, filePath);
+    removeMazeFile(mazeName);
 }
 
 void AssetManager::writeKeyMap(map<sf::Vector2i,vector<sf::Vector2i>>& keyMapIndices, const string& mazeName)
@@ -214,6 +320,7 @@ void AssetManager::writeKeyMap(map<sf::Vector2i,vector<sf::Vector2i>>& keyMapInd
     auto filePath = MAZE_DIRECTORY + mazeName + "_keymap.txt";
 
     fileWriter_.writeFile(keyMapIndices, filePath);
+    removeMazeFile(mazeName);
 }
 
 void AssetManager::writeStartPos(vector<sf::Vector2i>& startPos, const string& mazeName)
@@ -221,6 +328,7 @@ void AssetManager::writeStartPos(vector<sf::Vector2i>& startPos, const string& m
     auto filePath = MAZE_DIRECTORY + mazeName + "_startpositions.txt";
 
     fileWriter_.writeFile(startPos, filePath);
+    removeMazeFile(mazeName);
 }
 
 void AssetManager::deleteMazeData(string& mazeName)
@@ -259,6 +367,8 @@ void AssetManager::deleteMazeData(string& mazeName)
             cout << "FILE NOT DELETED" << endl;
     }
 
+    removeMazeFile(mazeName);
+
     str = HIGH_SCORE_DIRECTORY + mazeName + ".txt";
     n = str.length();
     char filePath[n + 1];
@@ -275,4 +385,33 @@ void AssetManager::writeHighScores(vector<pair<string, int>> highScores, const s
     fileWriter_.writeFile(highScores, filePath);
 }
 
+bool AssetManager::writeReplay(const Replay& replay, const string& filePath)
+{
+    return fileWriter_.writeFile(replay, filePath);
+}
+
+void AssetManager::reportFailure(const string& filePath)
+{
+    cout << "FAILED TO LOAD " << filePath << endl;
+    failedAssets_.push_back(filePath);
+}
 
+/*------------- Private helper functions -------------*/
+
+int AssetManager::findId(map<string,int>& ids, const string& name)
+{
+    // A new name is given the next free id, which the caller must then make room for
+    return ids.emplace(name, static_cast<int>(ids.size())).first->second;
+}
+
+sf::Music* AssetManager::findMusic(Song song)
+{
+    return music_[static_cast<size_t>(song)].get();
+}
+
+void AssetManager::removeMazeFile(const string& mazeName)
+{
+    // The binary maze is imported from the text files again the next time it is loaded
+    auto filePath = MAZE_DIRECTORY + mazeName + MAZE_FILE_EXTENSION;
+    remove(filePath.c_str());
+}
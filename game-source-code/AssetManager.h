@@ -7,11 +7,13 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 
+#include "Configuration.h"
 #include "FileReader.h"
 #include "FileWriter.h"
 #include "Maze.h"
 
 #include <map>
+#include <vector>
 
 using namespace std;
 
@@ -19,6 +21,8 @@ using namespace std;
 /// \brief This class manages the access to the resources required by the game during runtime
 ///
 /// It provides methods for loading resources into memory, writing to files from memeory, and providing access to textures, fonts, sounds, music, and other data saved by the user at runtime.
+///
+/// Textures and fonts are looked up by name once, which gives an id that indexes them directly afterwards. The built-in sounds and songs are indexed by the Sound and Song enums. Sounds and songs that have not been loaded are silently ignored (and report a stopped status), which allows a headless game to run without an audio device.
 
 class AssetManager
 {
@@ -33,9 +37,26 @@ public:
     /// @param filePath relative path to texture
     void loadTexture(const string& name, const string& filePath);
     
+    /// Add a texture that has already been loaded (see AssetLoader)
+    /// @param id texture id (see getTextureId)
+    /// @param texture shared pointer to the texture
+    void addTexture(int id, texturePtr texture);
+    
+    /// Get the id of the texture with the given name
+    ///
+    /// Names are resolved to ids once, and each id stays valid for the lifetime of the asset manager. A name that has not been loaded yet is given an id as well, so that ids can be resolved before the texture is loaded.
+    /// @param name texture name
+    /// \return the texture id
+    int getTextureId(const string& name);
+    
+    /// Get texture corresponding to the texture id given
+    /// @param id texture id (see getTextureId)
+    /// \return shared pointer to the requested texture, which is null if it has not been loaded
+    texturePtr getTexture(int id) const;
+    
     /// Get texture corresponding to the texture name given
     /// @param name texture name
-    /// \return shared pointer to the requested texture
+    /// \return shared pointer to the requested texture, which is null if it has not been loaded
     texturePtr getTexture(const string& name);
     
     /// Load a font into memory
@@ -43,46 +64,66 @@ public:
     /// @param filePath relative path to font
     void loadFont(const string& name, const string& filePath);
     
+    /// Add a font that has already been loaded (see AssetLoader)
+    /// @param id font id (see getFontId)
+    /// @param font shared pointer to the font
+    void addFont(int id, fontPtr font);
+    
+    /// Get the id of the font with the given name
+    /// @param name font name
+    /// \return the font id, which stays valid for the lifetime of the asset manager
+    int getFontId(const string& name);
+    
+    /// Get font corresponding to the font id given
+    /// @param id font id (see getFontId)
+    /// \return shared pointer to the requested font, which is null if it has not been loaded
+    fontPtr getFont(int id) const;
+    
     /// Get font corresponding to the font name given
     /// @param name font name
-    /// \return shared pointer to the requested font
+    /// \return shared pointer to the requested font, which is null if it has not been loaded
     fontPtr getFont(const string& name);
     
     /// Load a sound buffer into memory
-    /// @param name sound buffer name
+    /// @param sound the sound effect
     /// @param filePath relative path to sound buffer
-    void loadSoundBuffer(const string& name, const string& filePath);
+    void loadSoundBuffer(Sound sound, const string& filePath);
+    
+    /// Add a sound buffer that has already been loaded (see AssetLoader)
+    /// @param sound the sound effect
+    /// @param buffer shared pointer to the sound buffer
+    void addSoundBuffer(Sound sound, bufferPtr buffer);
     
-    /// Plays the sound corresponding to the sound buffer name given
-    /// @param name sound buffer name
-    void playSound(const string& name);
+    /// Plays the sound effect given
+    /// @param sound the sound effect
+    void playSound(Sound sound);
     
     /// Load a pointer to a music file into memory
-    /// @param name song name
+    /// @param song the song
     /// @param filePath relative path to music file
-    void loadMusic(const string& name, const string& filePath);
+    void loadMusic(Song song, const string& filePath);
     
-    /// Plays the song corresponding to the song name given
-    /// @param name song name
-    void playSong(const string& name);
+    /// Plays the song given
+    /// @param song the song
+    void playSong(Song song);
     
-    /// Pauses the song corresponding to the song name given
-    /// @param name song name
-    void pauseSong(const string& name);
+    /// Pauses the song given
+    /// @param song the song
+    void pauseSong(Song song);
     
-    /// Stops the song corresponding to the song name given
-    /// @param name song name
-    void stopSong(const string& name);
+    /// Stops the song given
+    /// @param song the song
+    void stopSong(Song song);
     
-    /// Sets the song corresponding to the song name given to loop continuously
-    /// @param name song name
+    /// Sets the song given to loop continuously
+    /// @param song the song
     /// @param isLoop boolean that is true if the song should loop continuously, and false if it should not
-    void setLoop(const string& name, bool isLoop);
+    void setLoop(Song song, bool isLoop);
     
-    /// Get the playing status of the song corresponding to the song name given
-    /// @param name song name
+    /// Get the playing status of the song given
+    /// @param song the song
     /// \return an enum representing the playing status of the song (Stopped, Paused or Playing)
-    sf::SoundSource::Status getStatus(const string& name);
+    sf::SoundSource::Status getStatus(Song song);
     
     /// Load the list of mazes into memory
     void loadMazeList();
@@ -126,6 +167,18 @@ public:
     /// \return a reference to a map relating a tuple of two ints (the key indices) to a vector of tuples of two ints (the gate indices)
     Maze::posKeyMap& getKeyMap(const string& name);
     
+    /// Load a whole maze into memory corresponding to the name given
+    ///
+    /// The maze is read from its binary maze file (see MazeFile), which is mapped into memory and unpacked into the maze's data without any text parsing. If there is no binary file yet, or it is older than any of the text files (e.g. after they are edited by hand) or damaged, the maze is imported from its four text files instead, and the binary file is written for next time
+    /// @param name maze name
+    /// @param mazeName the name of the maze
+    void loadMaze(const string& name, const string& mazeName);
+
+    /// Get the maze corresponding to the name given
+    /// @param name maze name
+    /// \return a reference to the maze's layout, rotation map, key map and start positions
+    Maze::Data& getMaze(const string& name);
+
     /// Load the character start positions into memory corresponding to the name given
     /// @param name character start positions file name
     /// @param mazeName the name of the maze
@@ -152,6 +205,16 @@ public:
     /// Get the credits for the game
     vector<string>& getCredits();
 
+    /// Load a replay into memory
+    /// @param filePath relative path to the replay file
+    void loadReplay(const string& filePath);
+
+    /// Get the replay that was last loaded
+    ///
+    /// The replay is empty (it has a length of zero) if it could not be loaded
+    /// \return a reference to the replay
+    Replay& getReplay();
+
 
     /*----------------------- Writing to Files--------------------------------*/
     
@@ -186,26 +249,52 @@ public:
     /// @param mazeName name of the maze
     void writeHighScores(vector<pair<string,int>> highScores, const string& mazeName);
 
+    /// Write a replay file
+    /// @param replay the replay to write
+    /// @param filePath relative path to the replay file
+    /// \return true if the replay was saved
+    bool writeReplay(const Replay& replay, const string& filePath);
+
+    /// Record that an asset could not be loaded, and log its path
+    ///
+    /// An asset that fails to load is not stored, so it stays in the state of an asset that has not been loaded
+    /// @param filePath relative path to the asset
+    void reportFailure(const string& filePath);
+
+    /// Get the assets that could not be loaded
+    /// \return the relative paths of the assets, in the order that they failed
+    const vector<string>& getFailedAssets() const {return failedAssets_;}
+
 private:
     vector<string> mazeList_;
     vector<string> credits_;
 
-    map<string,texturePtr> textures_;
-    map<string,fontPtr> fonts_;
+    map<string,int> textureIds_;
+    vector<texturePtr> textures_;
+    map<string,int> fontIds_;
+    vector<fontPtr> fonts_;
 
-    map<string,bufferPtr> buffers_;
-    map<string,sf::Sound> sounds_;
+    vector<bufferPtr> buffers_ = vector<bufferPtr>(static_cast<size_t>(Sound::COUNT));
+    vector<sf::Sound> sounds_ = vector<sf::Sound>(static_cast<size_t>(Sound::COUNT));
 
-    map<string,music_ptr> music_;
+    vector<music_ptr> music_ = vector<music_ptr>(static_cast<size_t>(Song::COUNT));
 
     map<string,vector<string>> layouts_;
     map<string,vector<string>> rotationMaps_;
     map<string,Maze::posKeyMap> keyMaps_;
     map<string,vector<sf::Vector2f>> startPos_;
+    map<string,Maze::Data> mazes_;
     vector<pair<string,int>> highScores_;
+    Replay replay_;
+    vector<string> failedAssets_;
 
     FileReader fileReader_;
     FileWriter fileWriter_;
+
+    // Private helper functions
+    int findId(map<string,int>& ids, const string& name);
+    sf::Music* findMusic(Song song);
+    void removeMazeFile(const string& mazeName);
 };
 
 #endif
@@ -0,0 +1,182 @@
+#include "AssetPack.h"
+
+#include "Configuration.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+
+bool AssetPack::open(const string& filePath)
+{
+    close();
+
+    if (!file_.open(filePath))
+        return false;
+
+    if (!validate())
+    {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void AssetPack::close()
+{
+    file_.close();
+
+    numEntries_ = 0;
+    entries_ = nullptr;
+    names_ = nullptr;
+}
+
+AssetPack::Blob AssetPack::find(const string& filePath) const
+{
+    // The entries are sorted by path, so they can be searched without building a map
+    auto first = 0;
+    auto last = numEntries_;
+
+    while (first < last)
+    {
+        auto middle = first + (last - first)/2;
+        auto entry = getEntry(middle);
+        auto comparison = getName(entry).compare(filePath);
+
+        if (comparison == 0)
+            return Blob{file_.getData() + entry.offset, static_cast<size_t>(entry.size)};
+
+        if (comparison < 0)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+
+    return Blob{};
+}
+
+bool AssetPack::write(const string& packPath, vector<string> filePaths)
+{
+    sort(filePaths.begin(), filePaths.end());
+    filePaths.erase(unique(filePaths.begin(), filePaths.end()), filePaths.end());
+
+    auto names = string{};
+    for (auto& filePath : filePaths)
+        names += filePath;
+
+    auto header = Header{};
+    memcpy(header.tag, ASSET_PACK_TAG, sizeof(header.tag));
+    header.version = ASSET_PACK_VERSION;
+    header.numEntries = filePaths.size();
+    header.namesSize = names.size();
+
+    auto align = [](uint64_t offset){return (offset + BLOB_ALIGNMENT - 1)/BLOB_ALIGNMENT*BLOB_ALIGNMENT;};
+
+    // Read every file first, so that the table of contents can be written before their contents
+    auto contents = vector<string>{};
+    auto entries = vector<Entry>{};
+    auto offset = align(sizeof(Header) + filePaths.size()*sizeof(Entry) + names.size());
+    auto nameOffset = uint32_t{0};
+
+    for (auto& filePath : filePaths)
+    {
+        ifstream file{filePath, ifstream::in | ifstream::binary};
+
+        if (!file)
+            return false;
+
+        contents.emplace_back(istreambuf_iterator<char>{file}, istreambuf_iterator<char>{});
+
+        entries.push_back(Entry{offset, contents.back().size(), nameOffset, static_cast<uint32_t>(filePath.size())});
+        offset = align(offset + contents.back().size());
+        nameOffset += filePath.size();
+    }
+
+    ofstream pack{packPath, ofstream::out | ofstream::binary | ofstream::trunc};
+
+    if (!pack)
+        return false;
+
+    pack.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    pack.write(reinterpret_cast<const char*>(entries.data()), entries.size()*sizeof(Entry));
+    pack.write(names.data(), names.size());
+
+    for (auto i = 0u; i < contents.size(); i++)
+    {
+        // Pad up to the start of the file's contents
+        pack << string(entries[i].offset - static_cast<uint64_t>(pack.tellp()), '\0');
+        pack.write(contents[i].data(), contents[i].size());
+    }
+
+    return static_cast<bool>(pack);
+}
+
+const AssetPack& AssetPack::getGamePack()
+{
+    static const auto pack = []()
+    {
+        auto pack = make_unique<AssetPack>();
+        pack->open(ASSET_PACK_FILEPATH);
+        return pack;
+    }();
+
+    return *pack;
+}
+
+/*------------- Private helper functions -------------*/
+
+bool AssetPack::validate()
+{
+    static_assert(sizeof(Header) == 16 && sizeof(Entry) == 24, "The asset pack's header and entries must not be padded");
+
+    auto data = file_.getData();
+    auto size = file_.getSize();
+
+    if (size < sizeof(Header))
+        return false;
+
+    Header header;
+    memcpy(&header, data, sizeof(Header));
+
+    if (memcmp(header.tag, ASSET_PACK_TAG, sizeof(header.tag)) != 0 || header.version != ASSET_PACK_VERSION)
+        return false;
+
+    auto tableSize = sizeof(Header) + static_cast<uint64_t>(header.numEntries)*sizeof(Entry) + header.namesSize;
+    if (tableSize > size)
+        return false;
+
+    numEntries_ = header.numEntries;
+    entries_ = data + sizeof(Header);
+    names_ = reinterpret_cast<const char*>(entries_ + numEntries_*sizeof(Entry));
+
+    // Every path and file must lie inside the pack, and the paths must be in order for find() to work
+    for (auto i = 0; i < numEntries_; i++)
+    {
+        auto entry = getEntry(i);
+
+        if (static_cast<uint64_t>(entry.nameOffset) + entry.nameLength > header.namesSize)
+            return false;
+
+        if (entry.offset < tableSize || entry.offset > size || entry.size > size - entry.offset)
+            return false;
+
+        if (i > 0 && getName(getEntry(i - 1)) >= getName(entry))
+            return false;
+    }
+
+    return true;
+}
+
+AssetPack::Entry AssetPack::getEntry(int index) const
+{
+    Entry entry;
+    memcpy(&entry, entries_ + index*sizeof(Entry), sizeof(Entry));
+    return entry;
+}
+
+string_view AssetPack::getName(const Entry& entry) const
+{
+    return string_view{names_ + entry.nameOffset, entry.nameLength};
+}
@@ -0,0 +1,105 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+/// \file AssetPack.h
+/// \brief Contains the class definition for the "AssetPack" class
+
+#include "MappedFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+/// \class AssetPack
+/// \brief A single archive holding the contents of many resource files, looked up by their original paths
+///
+/// Opening a hundred separate images, sounds and fonts at startup is slow on a cold cache or a network drive, so they are packed into one file by the AssetPacker tool. The pack starts with a header and a table of contents, sorted by path, followed by the files' contents, each starting on a BLOB_ALIGNMENT boundary. The pack is mapped into memory (see MappedFile), and each file's contents are handed straight to SFML's loadFromMemory or openFromMemory functions without being copied.
+///
+/// Files that are not in the pack, or every file if there is no pack, are read from their own files as before, so during development the game runs from the loose resources without a pack.
+
+class AssetPack
+{
+public:
+    static const size_t BLOB_ALIGNMENT = 64;    /**< the alignment of each file's contents, in bytes */
+
+    /// \struct The contents of one packed file
+    struct Blob
+    {
+        const void* data = nullptr;
+        size_t size = 0;
+
+        /// Check whether the file was found
+        explicit operator bool() const {return data != nullptr;}
+    };
+
+    /// Default constructor
+    AssetPack() {}
+
+    /// Map a pack into memory and check its table of contents
+    /// @param filePath the path of the pack
+    /// \return true if the pack was opened and is valid, and false otherwise
+    bool open(const string& filePath);
+
+    /// Unmap the pack, which invalidates every blob found in it
+    void close();
+
+    /// Check whether a valid pack is open
+    /// \return true if a pack is open, and false otherwise
+    bool isOpen() const {return file_.isOpen();}
+
+    /// Get the number of files in the pack
+    /// \return the number of files
+    int getNumFiles() const {return numEntries_;}
+
+    /// Find a file in the pack
+    /// @param filePath the path that the file was packed from, as given in the Configuration (e.g. "resources/fonts/...")
+    /// \return the file's contents, which stay valid while the pack is open, or an empty blob if it is not in the pack
+    Blob find(const string& filePath) const;
+
+    /// Pack files into a new pack
+    /// @param packPath the path of the pack to write
+    /// @param filePaths the paths of the files to pack, which are also the paths they are found by
+    /// \return true if every file was read and the pack was written, and false otherwise
+    static bool write(const string& packPath, vector<string> filePaths);
+
+    /// Get the game's asset pack, which is opened the first time it is needed and stays open until the program ends
+    ///
+    /// The pack may be shared between threads, since it is only ever read
+    /// \return a constant reference to the pack at ASSET_PACK_FILEPATH, which is not open if there is no valid pack
+    static const AssetPack& getGamePack();
+
+private:
+    /// \struct The start of every pack
+    struct Header
+    {
+        char tag[4];
+        uint32_t version;
+        uint32_t numEntries;
+        uint32_t namesSize;     // the size of the paths of all the files, which follow the entries
+    };
+
+    /// \struct An entry in the table of contents
+    struct Entry
+    {
+        uint64_t offset;        // from the start of the pack
+        uint64_t size;
+        uint32_t nameOffset;    // from the start of the paths
+        uint32_t nameLength;
+    };
+
+    MappedFile file_;
+    int numEntries_ = 0;
+    const unsigned char* entries_ = nullptr;
+    const char* names_ = nullptr;
+
+    // Private helper functions
+    bool validate();
+    Entry getEntry(int index) const;
+    string_view getName(const Entry& entry) const;
+};
+
+#endif
@@ -0,0 +1,158 @@
+#include "BatchSimulator.h"
+
+#include "Configuration.h"
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <random>
+#include <thread>
+
+BatchSimulator::BatchSimulator(const string& mazeName, int numGames, int maxFrames, int lvlNumber):
+mazeName_{mazeName},
+numGames_{numGames},
+maxFrames_{maxFrames},
+lvlNumber_{lvlNumber}
+{
+    controller_ = [](Simulation& simulation, int game)
+    {
+        const auto framesPerTurn = static_cast<int>(FRAME_RATE);
+        const sf::Keyboard::Key keys[] = {sf::Keyboard::Up, sf::Keyboard::Down, sf::Keyboard::Left, sf::Keyboard::Right};
+
+        if (simulation.getFrameCount() % framesPerTurn != 0)
+            return;
+
+        // Seeding from the game number and the turn keeps every game repeatable
+        auto engine = minstd_rand(game * 7919 + simulation.getFrameCount() / framesPerTurn);
+        simulation.pressKey(keys[engine() % 4]);
+    };
+}
+
+BatchSimulator::Results BatchSimulator::run(int numThreads)
+{
+    if (numThreads <= 0)
+        numThreads = max(1u, thread::hardware_concurrency());
+
+    numThreads = max(1, min(numThreads, numGames_));
+
+    // Deal the games out evenly, the workers rebalance by stealing
+    auto queues = vector<WorkQueue>(numThreads);
+    for (auto game = 0; game < numGames_; game++)
+        queues[game % numThreads].games.push_back(game);
+
+    auto results = vector<GameResult>(numGames_);
+    auto workers = vector<thread>{};
+
+    auto start = chrono::steady_clock::now();
+
+    for (auto worker = 0; worker < numThreads; worker++)
+        workers.emplace_back(&BatchSimulator::work, this, worker, ref(queues), ref(results));
+
+    for (auto& worker : workers)
+        worker.join();
+
+    auto seconds = chrono::duration<float>(chrono::steady_clock::now() - start).count();
+
+    return summarise(results, seconds);
+}
+
+/*------------- Private helper functions -------------*/
+
+void BatchSimulator::work(int worker, vector<WorkQueue>& queues, vector<GameResult>& results)
+{
+    auto game = 0;
+
+    // Each game writes to its own result, so no locking is needed here
+    while (takeGame(worker, queues, game))
+        results[game] = playGame(game);
+}
+
+bool BatchSimulator::takeGame(int worker, vector<WorkQueue>& queues, int& game)
+{
+    auto numQueues = static_cast<int>(queues.size());
+
+    // Own queue first (from the front), then steal from the back of the others
+    for (auto i = 0; i < numQueues; i++)
+    {
+        auto& queue = queues[(worker + i) % numQueues];
+        lock_guard<mutex> guard{queue.lock};
+
+        if (queue.games.empty())
+            continue;
+
+        if (i == 0)
+        {
+            game = queue.games.front();
+            queue.games.pop_front();
+        }
+        else
+        {
+            game = queue.games.back();
+            queue.games.pop_back();
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+BatchSimulator::GameResult BatchSimulator::playGame(int game)
+{
+    auto simulation = Simulation{mazeName_, lvlNumber_, static_cast<unsigned int>(game)};
+    auto startLives = simulation.getLivesLeft();
+
+    while (!simulation.isOver() && simulation.getFrameCount() < maxFrames_)
+    {
+        if (controller_)
+            controller_(simulation, game);
+
+        simulation.step();
+    }
+
+    GameResult result;
+    result.frames = simulation.getFrameCount();
+    result.score = simulation.getScore();
+    result.livesLost = startLives - simulation.getLivesLeft();
+    result.isCleared = simulation.isCleared();
+
+    return result;
+}
+
+BatchSimulator::Results BatchSimulator::summarise(const vector<GameResult>& results, float seconds) const
+{
+    Results summary;
+
+    summary.numGames = results.size();
+    summary.seconds = seconds;
+
+    if (results.empty())
+        return summary;
+
+    auto numCleared = 0;
+    auto livesLost = 0;
+
+    for (auto& result : results)
+    {
+        summary.totalFrames += result.frames;
+        summary.scores.push_back(result.score);
+        livesLost += result.livesLost;
+
+        if (result.isCleared)
+            numCleared++;
+    }
+
+    sort(summary.scores.begin(), summary.scores.end());
+
+    if (seconds > 0)
+        summary.framesPerSecond = summary.totalFrames / seconds;
+
+    summary.clearRate = static_cast<float>(numCleared) / summary.numGames;
+    summary.deathsPerLevel = static_cast<float>(livesLost) / summary.numGames;
+    summary.minScore = summary.scores.front();
+    summary.maxScore = summary.scores.back();
+    summary.medianScore = summary.scores[summary.scores.size()/2];
+    summary.meanScore = accumulate(summary.scores.begin(), summary.scores.end(), 0.0f) / summary.numGames;
+
+    return summary;
+}
@@ -0,0 +1,91 @@
+#ifndef BATCH_SIMULATOR_H
+#define BATCH_SIMULATOR_H
+
+/// \file BatchSimulator.h
+/// \brief Contains the class definition for the "BatchSimulator" class
+
+#include "Simulation.h"
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/// \class BatchSimulator
+/// \brief Runs many independent headless games in parallel and reports aggregate statistics
+///
+/// Every game is a separate Simulation with its own maze, characters and scoreboard, so no game state is shared between threads. The games are shared out among a pool of worker threads, each of which works through its own queue of games and steals from the back of the other queues once its own queue is empty, so that all cores stay busy even though the games take very different amounts of time to finish.
+
+class BatchSimulator
+{
+public:
+    typedef function<void(Simulation&, int)> controller; /**\typedef a function that scripts the input of a game, given the simulation and the game number. It is called before every frame */
+
+    /// \struct The aggregate statistics of a batch of games
+    struct Results
+    {
+        int numGames = 0;
+        long long totalFrames = 0;
+        float seconds = 0.0f;           // wall clock time taken to run the batch
+        float framesPerSecond = 0.0f;   // simulated frames per second of wall clock time, across all threads
+        float clearRate = 0.0f;         // fraction of games in which the maze was cleared
+        float deathsPerLevel = 0.0f;    // average number of lives lost per game
+        vector<int> scores;             // the final score of every game, in ascending order
+        int minScore = 0;
+        int maxScore = 0;
+        int medianScore = 0;
+        float meanScore = 0.0f;
+    };
+
+    /// Constructor
+    /// @param mazeName the name of the maze that every game is played on
+    /// @param numGames the number of games to simulate
+    /// @param maxFrames the maximum number of frames a game may last before it is stopped
+    /// @param lvlNumber the level number that every game starts at
+    BatchSimulator(const string& mazeName, int numGames, int maxFrames, int lvlNumber = 1);
+
+    /// Set the function that provides the input for each game
+    ///
+    /// By default the player is steered in a random direction every second, with a different (but repeatable) sequence for each game
+    /// @param gameController the function that scripts the input
+    void setController(controller gameController) {controller_ = gameController;}
+
+    /// Run the whole batch of games
+    /// @param numThreads the number of worker threads to use, or 0 to use one per hardware thread
+    /// \return the aggregate statistics of the batch
+    Results run(int numThreads = 0);
+
+private:
+    /// \struct The outcome of a single game
+    struct GameResult
+    {
+        int frames = 0;
+        int score = 0;
+        int livesLost = 0;
+        bool isCleared = false;
+    };
+
+    /// \struct A queue of games waiting to be simulated by a worker thread
+    struct WorkQueue
+    {
+        deque<int> games;
+        mutex lock;
+    };
+
+    string mazeName_;
+    int numGames_;
+    int maxFrames_;
+    int lvlNumber_;
+    controller controller_;
+
+    // Private helper functions
+    void work(int worker, vector<WorkQueue>& queues, vector<GameResult>& results);
+    bool takeGame(int worker, vector<WorkQueue>& queues, int& game);
+    GameResult playGame(int game);
+    Results summarise(const vector<GameResult>& results, float seconds) const;
+};
+
+#endif
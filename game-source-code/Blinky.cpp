@@ -2,24 +2,13 @@
 #include <cmath>
 #include <iostream>
 
-#include "EnemyScatterState.h"
-
-Blinky::Blinky(map<string,texturePtr> textures, sf::Vector2f position, playerPtr player, mazePtr maze) :
-    Enemy(textures, position, player, maze)
+Blinky::Blinky(Clips clips, sf::Vector2f position, playerPtr player, mazePtr maze) :
+    Enemy(clips, position, player, maze)
 {
     current_dir_ = RIGHT;
     default_dir_ = RIGHT;
 }
 
-void Blinky::update(float dt)
-{
-    if (char_states_.empty())
-        addCharState(std::make_shared<EnemyScatterState>(this, maze_));
-
-    updateCharState();
-    char_states_.top()->update(dt);
-}
-
 sf::Vector2f Blinky::getChaseTarget()
 {
     return player_->getCurrentTile();
@@ -33,7 +33,7 @@ void Button::draw(sf::RenderTarget& target, sf::RenderStates states) const
     target.draw(outline_);
 }
 
-void Button::update(const sf::RenderWindow& window)
+void Button::update(const sf::RenderWindow& window, const sf::View& view)
 {
     if (isSelected_)
     {
@@ -43,6 +43,7 @@ void Button::update(const sf::RenderWindow& window)
             sprite_.setColor(spriteSelectedColour_);
             outline_.setOutlineColor(outlineSelectedColour_);
             isAlreadySelected_ = true;
+            revision_++;
         }
     }
     else if (!isSelected_)
@@ -52,7 +53,7 @@ void Button::update(const sf::RenderWindow& window)
         isAlreadySelected_ = false;
         }
         
-        if (isHover(window))
+        if (isHover(window, view))
         {
             if (!isAlreadyHover_)
             {
@@ -60,9 +61,10 @@ void Button::update(const sf::RenderWindow& window)
                 sprite_.setColor(spriteHoverColour_);
                 outline_.setOutlineColor(outlineHoverColour_);
                 isAlreadyHover_ = true;
+                revision_++;
             }
         }
-        else if (!isHover(window))
+        else if (!isHover(window, view))
         {
             if (isAlreadyHover_)
             {
@@ -70,6 +72,7 @@ void Button::update(const sf::RenderWindow& window)
                 sprite_.setColor(spriteColour_);
                 outline_.setOutlineColor(outlineColour_);
                 isAlreadyHover_ = false;
+                revision_++;
             }
         }
     }
@@ -86,11 +89,11 @@ void Button::toggleSelection()
         isSelected_ = true;
 }
 
-bool Button::isHover(const sf::RenderWindow& window) const
+bool Button::isHover(const sf::RenderWindow& window, const sf::View& view) const
 {
     auto spriteBounds = sprite_.getGlobalBounds();
 
-    if (spriteBounds.contains(window.mapPixelToCoords(sf::Mouse::getPosition(window))))
+    if (spriteBounds.contains(window.mapPixelToCoords(sf::Mouse::getPosition(window), view)))
         return true;
 
     return false;
@@ -106,6 +109,7 @@ void Button::setString(const string& text)
     text_.setScale(textScale_);
     text_.setFillColor(textColour_);
     text_.setRotation(angle_);
+    revision_++;
 
     // Error checking to ensure text fits within sprite
 }
@@ -121,10 +125,14 @@ void Button::setOutline(float thickness)
     outline_.setPosition(sprite_.getPosition());
     outline_.setFillColor(sf::Color::Transparent);
     outline_.setOutlineColor(outlineColour_);
+    revision_++;
 }
 
 void Button::setPosition(float x, float y)
 {
+    if (position_ != sf::Vector2f{x,y})
+        revision_++;
+
     position_ = sf::Vector2f{x,y};
     sprite_.setPosition(x,y);
     text_.setPosition(x,y);
@@ -133,6 +141,9 @@ void Button::setPosition(float x, float y)
 
 void Button::setPosition(sf::Vector2f position)
 {
+    if (position_ != position)
+        revision_++;
+
     position_ = position;
     sprite_.setPosition(position);
     text_.setPosition(position);
@@ -143,12 +154,14 @@ void Button::setSpriteScale(float factorX, float factorY)
 {
     spriteScale_ = sf::Vector2f{factorX, factorY};
     sprite_.setScale(factorX, factorY);
+    revision_++;
 }
 
 void Button::setTextScale(float factorX, float factorY)
 {
     textScale_ = sf::Vector2f{factorX, factorY};
     text_.setScale(factorX, factorY);
+    revision_++;
 }
 
 void Button::setRotation(float angle)
@@ -157,6 +170,7 @@ void Button::setRotation(float angle)
     sprite_.setRotation(angle);
     text_.setRotation(angle);
     outline_.setRotation(angle);
+    revision_++;
 }
 
 void Button::setColour(sf::Color colour)
@@ -14,6 +14,8 @@ using namespace std;
 /// \brief An object used to receive user input based on the position of the mouse
 ///
 /// The button class is a wrapper for a text-sprite combination. The button class does not perform any actions when clicked, but rather is able to report whether the mouse is contained within its borders. The class in which an instance of the button is contained gives the button its activated behaviour by querying whether the mouse button is clicked while the mouse is hovering over the button. The button updates its visual appearance based on whether it is selected, being hovered over, or neither of these things. Note that the origin of the button is always the centre of the sprite.
+///
+/// Each change in the button's appearance increases its revision, so that a RenderLayer holding the button can tell when it needs to be rendered again.
 
 class Button: public sf::Drawable
 {
@@ -45,7 +47,12 @@ public:
     ///
     /// This is done by adjusting the colour settings of the button sprite, outline and text according to whether the button is selected, being hovered over, or none of the above
     /// @param window Reference window
-    void update(const sf::RenderWindow& window);
+    void update(const sf::RenderWindow& window) {update(window, window.getView());}
+
+    /// Update the appearance of a button placed in a view other than the window's current one, e.g. one that scrolls
+    /// @param window Reference window
+    /// @param view the view that the button is drawn in
+    void update(const sf::RenderWindow& window, const sf::View& view);
     
     /// Select the button.
     ///
@@ -65,7 +72,13 @@ public:
     /// Query whether the button boundries contain the mouse coordinates.
     /// @param window Reference window
     /// \return boolean that is true when the mouse is within the boundries of the button, and false if it is not
-    bool isHover(const sf::RenderWindow& window) const;
+    bool isHover(const sf::RenderWindow& window) const {return isHover(window, window.getView());}
+
+    /// Query whether the boundries of a button placed in a view other than the window's current one contain the mouse coordinates.
+    /// @param window Reference window
+    /// @param view the view that the button is drawn in
+    /// \return boolean that is true when the mouse is within the boundries of the button, and false if it is not
+    bool isHover(const sf::RenderWindow& window, const sf::View& view) const;
     
     /// Set the text displayed on the button.
     /// @param text string containing the button text
@@ -146,6 +159,10 @@ public:
     /// \return angle of rotation in degrees
     float getRotation() {return angle_;}
 
+    /// Get the number of times the button has changed appearance
+    /// \return the revision of the button
+    int getRevision() const {return revision_;}
+
 private:
     texturePtr texture_;
     fontPtr font_;
@@ -174,6 +191,7 @@ private:
     bool isSelected_ = false;
     bool isAlreadySelected_ = false;
     bool isAlreadyHover_ = true;
+    int revision_ = 0;
 };
 
 #endif
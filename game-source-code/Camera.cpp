@@ -0,0 +1,48 @@
+#include "Camera.h"
+
+#include <algorithm>
+
+using namespace std;
+
+Camera::Camera(sf::FloatRect screenArea):
+    screenArea_{screenArea},
+    centre_{screenArea.left + screenArea.width/2, screenArea.top + screenArea.height/2}
+{
+}
+
+void Camera::follow(sf::Vector2f target, sf::FloatRect worldBounds)
+{
+    auto halfSize = sf::Vector2f{screenArea_.width/2, screenArea_.height/2};
+
+    if (worldBounds.width > screenArea_.width)
+        centre_.x = clamp(target.x, worldBounds.left + halfSize.x, worldBounds.left + worldBounds.width - halfSize.x);
+    else
+        centre_.x = screenArea_.left + halfSize.x;
+
+    if (worldBounds.height > screenArea_.height)
+        centre_.y = clamp(target.y, worldBounds.top + halfSize.y, worldBounds.top + worldBounds.height - halfSize.y);
+    else
+        centre_.y = screenArea_.top + halfSize.y;
+}
+
+sf::FloatRect Camera::getVisibleArea() const
+{
+    auto size = sf::Vector2f{screenArea_.width, screenArea_.height};
+    return sf::FloatRect{centre_ - size/2.f, size};
+}
+
+sf::View Camera::getView(const sf::View& screenView) const
+{
+    auto view = sf::View{centre_, sf::Vector2f{screenArea_.width, screenArea_.height}};
+
+    // The camera's share of the screen view's viewport
+    auto viewport = screenView.getViewport();
+    auto screenSize = screenView.getSize();
+    auto screenTopLeft = screenView.getCenter() - screenSize/2.f;
+
+    view.setViewport(sf::FloatRect{viewport.left + viewport.width * (screenArea_.left - screenTopLeft.x)/screenSize.x,
+                                   viewport.top + viewport.height * (screenArea_.top - screenTopLeft.y)/screenSize.y,
+                                   viewport.width * screenArea_.width/screenSize.x,
+                                   viewport.height * screenArea_.height/screenSize.y});
+    return view;
+}
@@ -0,0 +1,48 @@
+#ifndef CAMERA_H
+#define CAMERA_H
+
+/// \file Camera.h
+/// \brief Contains the class definition for the "Camera" class
+
+#include <SFML/Graphics.hpp>
+
+/// \class Camera
+/// \brief Shows part of the game world in an area of the screen, following a target through worlds too large to fit
+///
+/// Along each axis on which the world fits inside the screen area, the camera stays still, so that world coordinates are the same as screen coordinates. Along an axis on which the world is larger, the camera is centred on its target, but never shows anything beyond the edge of the world.
+
+class Camera
+{
+public:
+    /// Default constructor
+    Camera() {}
+
+    /// Constructor
+    /// @param screenArea the area of the screen the world is shown in, in the coordinates of the game's view
+    Camera(sf::FloatRect screenArea);
+
+    /// Move the camera towards a target
+    /// @param target the coordinates to centre the camera on, in the form sf::Vector2f{x,y}
+    /// @param worldBounds the area of the world which can be shown
+    void follow(sf::Vector2f target, sf::FloatRect worldBounds);
+
+    /// Get the area of the world the camera currently shows
+    /// \return the visible area, in world coordinates
+    sf::FloatRect getVisibleArea() const;
+
+    /// Query whether any part of an area can be seen
+    /// @param area an area in world coordinates, e.g. the bounds of a sprite
+    /// \return true if the area overlaps the visible area, and false otherwise
+    bool isVisible(sf::FloatRect area) const {return getVisibleArea().intersects(area);}
+
+    /// Get a view which draws the visible area of the world into the camera's area of the screen
+    /// @param screenView the view of the whole game screen (which may be letterboxed)
+    /// \return the camera's view
+    sf::View getView(const sf::View& screenView) const;
+
+private:
+    sf::FloatRect screenArea_;
+    sf::Vector2f centre_;
+};
+
+#endif
@@ -1,22 +1,30 @@
 #include "Character.h"
 #include <iostream>
 
-/*------------- Static Members ---------------------*/
-int Character::lvlNumber_ = 1;
+Character::Character(sf::Vector2f position, mazePtr maze) :
+position_{position}, default_position_{position}, previous_position_{position}, maze_{maze}
+{sprite_.setPosition(position_);};
 
-void Character::setLevelNumber(const int& lvlNumber)
+sf::Sprite Character::getSprite()
 {
-    lvlNumber_ = lvlNumber;
+    return sprite_;
 }
-/*--------------------------------------------------*/
 
-Character::Character(map<string,texturePtr> textures, sf::Vector2f position, mazePtr maze) :
-stateTextures{textures}, position_{position}, default_position_{position}, maze_{maze}
-{sprite_.setPosition(position_);};
+sf::Sprite Character::getSprite(float alpha)
+{
+    auto sprite = sprite_;
+    sprite.setPosition(previous_position_ + (sprite_.getPosition() - previous_position_)*alpha);
+    return sprite;
+}
 
-sf::Sprite Character::getSprite()
+void Character::savePosition()
 {
-    return sprite_;
+    previous_position_ = sprite_.getPosition();
+}
+
+void Character::setLevelNumber(const int& lvlNumber)
+{
+    lvlNumber_ = lvlNumber;
 }
 
 sf::Vector2f Character::currentDir() const
@@ -36,7 +44,7 @@ void Character::updateDir()
 
 sf::Vector2f Character::getCurrentTile()
 {
-    return maze_->getTile(position_)->getPosition();
+    return maze_->getTilePosition(position_);
 }
 
 void Character::moveCharacter(const sf::Vector2f& delta)
@@ -45,6 +53,13 @@ void Character::moveCharacter(const sf::Vector2f& delta)
     sprite_.setPosition(position_);
 }
 
+void Character::teleport(const sf::Vector2f& position)
+{
+    position_ = position;
+    sprite_.setPosition(position_);
+    previous_position_ = position_;
+}
+
 void Character::addCharState(charStatePtr state)
 {
     new_state_ = state;
@@ -65,6 +80,7 @@ void Character::updateCharState()
             char_states_.pop();
             is_removing = false;
         }
+        new_state_->restart();
         char_states_.push(new_state_);
         is_adding = false;
         char_states_.top()->enter();
@@ -9,10 +9,11 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 #include <memory>
-#include <stack>
 #include <cmath>
 
+#include "Animator.h"
 #include "CharacterState.h"
+#include "CharacterStateStack.h"
 #include "Maze.h"
 
 /** \class Character
@@ -34,8 +35,9 @@
 class Character
 {
     public:
-        typedef std::shared_ptr<CharacterState> charStatePtr; /**< Alias for a shared pointer to CharacterState */
+        typedef CharacterState* charStatePtr; /**< Alias for a pointer to a CharacterState, which the character owns */
         typedef shared_ptr<sf::Texture> texturePtr; /**< Alias for a shared pointer to sf::Texture */
+        typedef Animator::clipPtr clipPtr; /**< Alias for a shared pointer to an immutable AnimationClip */
         typedef Maze* mazePtr; /**< Alias for a pointer to a Maze, to improve readability */
 
         /** \brief Default constructor for Character class */
@@ -44,10 +46,10 @@ class Character
         /** \brief Constructor for Character class
          *
          *  The constructor initialises a few of the members of each character,
-         *  such as the map of textures, the initial and default positions, as
-         *  well as a pointer to the Maze.
+         *  such as the initial and default positions, as well as a pointer to the Maze.
+         *  The derived classes hold their own animation clips.
          */
-        Character(map<string,texturePtr> textures, sf::Vector2f position, mazePtr maze);
+        Character(sf::Vector2f position, mazePtr maze);
 
         /** \brief Destructor for Character class */
         virtual ~Character() {};
@@ -58,6 +60,39 @@ class Character
          */
         sf::Sprite getSprite();
 
+        /** \brief Returns the Character sprite, placed between its last two positions
+         *
+         *  The game is updated in fixed steps, but may be drawn at any time between them.
+         *  Drawing the sprite part of the way from where it was at the start of the last
+         *  update to where it is now keeps the movement smooth at any frame rate.
+         *
+         *  \param alpha: The fraction of an update step since the last update, between 0 and 1
+         *  \return sf::Sprite for the character, at the interpolated position
+         */
+        sf::Sprite getSprite(float alpha);
+
+        /** \brief Remembers where the character is at the start of an update step
+         *
+         *  This should be called before each update, so that the sprite can be
+         *  interpolated from this position (see getSprite(float)).
+         */
+        void savePosition();
+
+        /** \brief Returns the position of the character
+         *
+         *  \return sf::Vector2f containing the x and y coordinates of the character
+         */
+        sf::Vector2f getPosition() const {return position_;}
+
+        /** \brief Returns the position of the character at the start of the last update step
+         *
+         *  Together with getPosition(), this gives the path the character moved along
+         *  during the last update (see savePosition()).
+         *
+         *  \return sf::Vector2f containing the x and y coordinates of the character
+         */
+        sf::Vector2f getPreviousPosition() const {return previous_position_;}
+
         /** \brief Returns the current direction of the character
          *
          *  Directions are defined as being an sf::Vector2f since SFML makes extensive
@@ -97,7 +132,7 @@ class Character
          *  are updated. It provides a default implementation which can be overridden
          *  by derived classes.
          *
-         *  \param state: This a shared pointer to the new state to be added
+         *  \param state: This a pointer to the new state to be added (see getCharState())
          */
         virtual void addCharState(charStatePtr state);
 
@@ -113,9 +148,10 @@ class Character
 
         /** \brief  Updates the state of the character
          *
-         *  The states are held within an STL stack so if a state is marked to be added,
-         *  it will be pushed onto the top of the stack. If the current state needs to
-         *  be removed, it will also pop the state off
+         *  The states are held within a CharacterStateStack so if a state is marked to be added,
+         *  it will be restarted and pushed onto the top of the stack. If the current state needs to
+         *  be removed, it will also pop the state off, and the state below it is entered again
+         *  where it left off
          */
         virtual void updateCharState();
 
@@ -129,18 +165,6 @@ class Character
          */
         virtual void update(float dt) = 0;
 
-        /** \brief  Animates the character
-         *
-         *  This is an abstract function which requires the derived class to provide an
-         *  implementation, as necessary, since animation is different depending on
-         *  the derived class.
-         *
-         *  \param dt: This is a float of the time which has elapsed since the last call
-         *  \param textureKey: A string which maps to a texture stored in the texture map
-         *         of the character
-         */
-        virtual void animate(float dt, string textureKey) = 0;
-
         /** \brief Moves the character by a specified amount
          *
          *  The character's position (an sf::Vector2f) and sprite (sf::Sprite) position
@@ -152,6 +176,16 @@ class Character
          */
         void moveCharacter(const sf::Vector2f& delta);
 
+        /** \brief Moves the character straight to a position
+         *
+         *  Unlike moveCharacter(), the character jumps to the new position without
+         *  passing through the positions in between, so its sprite is not interpolated
+         *  across the maze (e.g. when wrapping around the edge of the maze or respawning).
+         *
+         *  \param position: The new position of the character
+         */
+        void teleport(const sf::Vector2f& position);
+
         /** \brief Checks if the character is in an interactive or non-interactive state
          */
         bool isInteractive() const;
@@ -162,33 +196,38 @@ class Character
          */
         void toggleInteractivity();
 
-        /** \brief Sets the level number across all Characters
+        /** \brief Sets the level number of the Character
          *
-         *  The level number should always be the same for all characters so it is set
-         *  via static functions and members.
+         *  The level number should always be the same for all characters in a level,
+         *  since it determines their speeds.
          *
          *  \param lvlNumber: The current level number
          */
-        static void setLevelNumber(const int& lvlNumber);
+        void setLevelNumber(const int& lvlNumber);
 
     protected:
-
-
+        /** \brief Returns the character's state of a given type, which is only made the first time it is needed
+         *
+         *  \param owner: A pointer to the derived character, which is passed to the state's constructor
+         *  \return A pointer to the state, to be passed to addCharState()
+         */
+        template <typename State, typename Owner>
+        State* getCharState(Owner* owner) {return char_states_.get<State>(owner, maze_);}
 
         texturePtr texture_;
         sf::Sprite sprite_;
         sf::Vector2f position_;
         sf::Vector2f default_position_;
+        sf::Vector2f previous_position_;
 
-        static int lvlNumber_;
+        int lvlNumber_ = 1;
 
-        map<string,texturePtr> stateTextures;
-        float animateTime = 0;
+        Animator animator_;
 
-        std::stack<charStatePtr> char_states_;
+        CharacterStateStack char_states_;
         bool is_removing = false;
         bool is_adding = false;
-        charStatePtr new_state_;
+        charStatePtr new_state_ = nullptr;
         mazePtr maze_;
 
         sf::Vector2f current_dir_;
@@ -18,6 +18,10 @@
  *  defined by the state. This base class provides a means of doing that via
  *  polymorphism - every state can be referred to as a CharacterState object,
  *  and the update and enter functions can be called on them.
+ *
+ *  Each character makes each of its states once and reuses it (see CharacterStateStack),
+ *  so the time spent in a state is kept here, where it can be restarted whenever the
+ *  state is added to the character's stack again.
  */
 class CharacterState
 {
@@ -33,6 +37,15 @@ public:
     virtual void update(float dt) = 0;
     /** Abstract function for state specific entrance behaviour*/
     virtual void enter() = 0;
+    /** Start the state again from the beginning, when it is added to the stack*/
+    void restart() {timeInState_ = 0;}
+    /** Returns the time spent in the state since it was last restarted*/
+    float getTime() const {return timeInState_;}
+    /** Sets the time spent in the state, for characters which keep track of it themselves (see Enemy::Motion)*/
+    void setTime(float time) {timeInState_ = time;}
+
+protected:
+    float timeInState_ = 0;
 
 private:
 
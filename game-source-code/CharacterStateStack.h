@@ -0,0 +1,110 @@
+#ifndef CHARACTER_STATE_STACK_H
+#define CHARACTER_STATE_STACK_H
+/** \file CharacterStateStack.h
+    \brief Contains the class definition for the "CharacterStateStack" class, which holds
+    the states of a character
+*/
+
+#include "CharacterState.h"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <typeinfo>
+#include <vector>
+
+/** \class CharacterStateStack
+ *  \brief A fixed-size stack of a character's states, which owns one of each state
+ *
+ *  A character makes each type of state the first time it is needed, and then reuses
+ *  it every time it enters that state, so that changing state never allocates memory.
+ *  As there is only one of each state, adding a state which is already on the stack
+ *  moves it to the top rather than adding a second copy. The stack can therefore never
+ *  hold more states than the character has types of state.
+ *
+ *  States refer to the character which made them, so a copy of the stack starts empty
+ *  and the copied character makes its own states.
+ */
+class CharacterStateStack
+{
+    public:
+        static const int CAPACITY = 8; /**< The most states that can be on the stack */
+
+        /** \brief Default constructor */
+        CharacterStateStack() {}
+
+        /** \brief Copy constructor, which gives an empty stack */
+        CharacterStateStack(const CharacterStateStack&) {}
+
+        /** \brief Copy assignment, which empties the stack */
+        CharacterStateStack& operator=(const CharacterStateStack&)
+        {
+            clear();
+            owned_.clear();
+            return *this;
+        }
+
+        /** \brief Returns the character's state of a given type, making it if it has not been needed before
+         *
+         *  \param owner, a pointer to the character, which is passed to the state's constructor
+         *  \param maze, a pointer to the maze, which is passed to the state's constructor
+         *  \return a pointer to the state, which remains owned by the stack
+         */
+        template <typename State, typename Owner, typename Maze>
+        State* get(Owner* owner, Maze* maze)
+        {
+            for (auto& state : owned_)
+            {
+                if (typeid(*state) == typeid(State))
+                    return static_cast<State*>(state.get());
+            }
+
+            owned_.push_back(std::make_unique<State>(owner, maze));
+            return static_cast<State*>(owned_.back().get());
+        }
+
+        /** \brief Checks whether there are no states on the stack */
+        bool empty() const {return size_ == 0;}
+
+        /** \brief Returns the number of states on the stack */
+        int size() const {return size_;}
+
+        /** \brief Returns the state on top of the stack, which must not be empty */
+        CharacterState* top() const {return states_[size_-1];}
+
+        /** \brief Adds a state to the top of the stack, removing it from further down if it is already there
+         *
+         *  \param state, a pointer to a state returned by get()
+         */
+        void push(CharacterState* state)
+        {
+            auto end = std::remove(states_.begin(), states_.begin() + size_, state);
+            size_ = end - states_.begin();
+
+            // Only reachable with more types of state than CAPACITY: the oldest state is forgotten
+            if (size_ == CAPACITY)
+            {
+                std::move(states_.begin() + 1, states_.end(), states_.begin());
+                size_--;
+            }
+
+            states_[size_++] = state;
+        }
+
+        /** \brief Removes the state on top of the stack */
+        void pop()
+        {
+            if (size_ > 0)
+                size_--;
+        }
+
+        /** \brief Removes every state from the stack (the states themselves are kept for reuse) */
+        void clear() {size_ = 0;}
+
+    private:
+        std::vector<std::unique_ptr<CharacterState>> owned_;
+        std::array<CharacterState*, CAPACITY> states_{};
+        int size_ = 0;
+};
+
+#endif // CHARACTER_STATE_STACK_H
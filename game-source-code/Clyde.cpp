@@ -2,24 +2,13 @@
 #include <cmath>
 #include <iostream>
 
-#include "EnemyScatterState.h"
-
-Clyde::Clyde(map<string,texturePtr> textures, sf::Vector2f position, playerPtr player, mazePtr maze) :
-         Enemy(textures, position, player, maze)
+Clyde::Clyde(Clips clips, sf::Vector2f position, playerPtr player, mazePtr maze) :
+         Enemy(clips, position, player, maze)
 {
     current_dir_ = LEFT;
     default_dir_ = LEFT;
 }
 
-void Clyde::update(float dt)
-{
-    if (char_states_.empty())
-        addCharState(std::make_shared<EnemyScatterState>(this, maze_));
-
-    updateCharState();
-    char_states_.top()->update(dt);
-}
-
 sf::Vector2f Clyde::getChaseTarget()
 {
     auto target = sf::Vector2f{0,0};
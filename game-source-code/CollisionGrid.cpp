@@ -0,0 +1,93 @@
+#include "CollisionGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+CollisionGrid::CollisionGrid(sf::Vector2f origin, float cellSize):
+    origin_{origin},
+    cellSize_{cellSize}
+{
+}
+
+void CollisionGrid::clear()
+{
+    entries_.clear();
+    isSorted_ = true;
+}
+
+void CollisionGrid::add(int id, sf::Vector2f from, sf::Vector2f to)
+{
+    findCells(from, to);
+
+    for (auto cell : cells_)
+        entries_.push_back({cell, id});
+
+    isSorted_ = false;
+}
+
+void CollisionGrid::query(sf::Vector2f from, sf::Vector2f to, vector<int>& ids)
+{
+    ids.clear();
+
+    if (!isSorted_)
+    {
+        sort(entries_.begin(), entries_.end());
+        isSorted_ = true;
+    }
+
+    findCells(from, to);
+
+    for (auto cell : cells_)
+    {
+        auto first = lower_bound(entries_.begin(), entries_.end(), make_pair(cell, numeric_limits<int>::min()));
+
+        for (auto entry = first; entry != entries_.end() && entry->first == cell; ++entry)
+            ids.push_back(entry->second);
+    }
+
+    sort(ids.begin(), ids.end());
+    ids.erase(unique(ids.begin(), ids.end()), ids.end());
+}
+
+bool CollisionGrid::isSweptCollision(sf::Vector2f from1, sf::Vector2f to1, sf::Vector2f from2, sf::Vector2f to2, float distance)
+{
+    // Find when the characters were closest, relative to the second character
+    auto start = from1 - from2;
+    auto velocity = (to1 - from1) - (to2 - from2);
+    auto speedSquared = velocity.x*velocity.x + velocity.y*velocity.y;
+
+    auto time = 0.f;
+    if (speedSquared > 0)
+        time = clamp(-(start.x*velocity.x + start.y*velocity.y)/speedSquared, 0.f, 1.f);
+
+    auto closest = start + velocity*time;
+    return closest.x*closest.x + closest.y*closest.y < distance*distance;
+}
+
+/*------------- Private helper functions -------------*/
+
+CollisionGrid::Cell CollisionGrid::getCell(sf::Vector2f position) const
+{
+    auto row = static_cast<long long>(floor((position.y - origin_.y)/cellSize_));
+    auto col = static_cast<long long>(floor((position.x - origin_.x)/cellSize_));
+
+    return (row << 32) ^ (col & 0xFFFFFFFF);
+}
+
+void CollisionGrid::findCells(sf::Vector2f from, sf::Vector2f to)
+{
+    cells_.clear();
+
+    // Sample the path at least twice per cell, so that no cell it crosses is skipped
+    auto delta = to - from;
+    auto length = sqrt(delta.x*delta.x + delta.y*delta.y);
+    auto numSteps = max(1, static_cast<int>(ceil(2*length/cellSize_)));
+
+    for (auto step = 0; step <= numSteps; step++)
+    {
+        auto cell = getCell(from + delta*(static_cast<float>(step)/numSteps));
+        if (cells_.empty() || cells_.back() != cell)
+            cells_.push_back(cell);
+    }
+}
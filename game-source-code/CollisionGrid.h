@@ -0,0 +1,70 @@
+#ifndef COLLISION_GRID_H
+#define COLLISION_GRID_H
+
+/// \file CollisionGrid.h
+/// \brief Contains the class definition for the "CollisionGrid" class
+
+#include <SFML/Graphics.hpp>
+
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/// \class CollisionGrid
+/// \brief A spatial hash of the tiles that characters passed through during one update
+///
+/// Each character is added with the path it moved along in the last update, and is recorded in every tile (cell) of the grid that the path touches. Querying another path then returns only the characters which shared a cell with it, so that a collision check against many characters only has to look closely at the few that are nearby. The cells are kept as a sorted list rather than a grid of buckets, so the memory used depends on the number of characters and not the size of the maze, and refilling the grid every update does not allocate.
+
+class CollisionGrid
+{
+public:
+    /// Default constructor
+    CollisionGrid() {}
+
+    /// Constructor
+    /// @param origin the top left corner of the cell in the first row and column, in the form sf::Vector2f{x,y}
+    /// @param cellSize the length of each cell (e.g. the maze's tile length)
+    CollisionGrid(sf::Vector2f origin, float cellSize);
+
+    /// Remove every character from the grid
+    void clear();
+
+    /// Add a character to every cell that its path touches
+    /// @param id an identifier for the character, such as its index in a roster
+    /// @param from the position of the character at the start of the update
+    /// @param to the position of the character at the end of the update
+    void add(int id, sf::Vector2f from, sf::Vector2f to);
+
+    /// Find the characters that shared a cell with a path
+    /// @param from the start of the path
+    /// @param to the end of the path
+    /// @param ids filled with the identifiers of the characters found, in ascending order and without repeats
+    void query(sf::Vector2f from, sf::Vector2f to, vector<int>& ids);
+
+    /// Check whether two characters came within a given distance of each other while moving along their paths
+    ///
+    /// Both characters are assumed to move at a constant speed during the update, so two characters which pass through each other between updates are found, however fast they are moving.
+    /// @param from1 the position of the first character at the start of the update
+    /// @param to1 the position of the first character at the end of the update
+    /// @param from2 the position of the second character at the start of the update
+    /// @param to2 the position of the second character at the end of the update
+    /// @param distance the distance between the characters at which they collide
+    /// \return true if the characters collide, and false otherwise
+    static bool isSweptCollision(sf::Vector2f from1, sf::Vector2f to1, sf::Vector2f from2, sf::Vector2f to2, float distance);
+
+private:
+    typedef long long Cell;
+
+    sf::Vector2f origin_;
+    float cellSize_ = 1.f;
+    vector<pair<Cell,int>> entries_;    // (cell, id), sorted by cell before querying
+    bool isSorted_ = true;
+    vector<Cell> cells_;                // scratch space for the cells of a path
+
+    // Private helper functions
+    Cell getCell(sf::Vector2f position) const;
+    void findCells(sf::Vector2f from, sf::Vector2f to);
+};
+
+#endif
@@ -8,10 +8,22 @@
 
 const auto GAME_WIDTH = 828.0f; //782.0f;
 const auto GAME_HEIGHT = 900.0f;
+const auto SCREEN_AREA = sf::FloatRect{0.f, 0.f, GAME_WIDTH, GAME_HEIGHT};     // the whole view, as covered by the menus' render layers
 const auto GAME_TITLE = "HARAMBE'S QUEST";
 const auto WINDOW_STYLE = (sf::Style::Resize + sf::Style::Close); // sf::Style::Titlebar | sf::Style::Close; // sf::Style::Default;
 const auto FRAME_RATE = 60.0f;
 const auto MS_PER_FRAME = 1000.0f/FRAME_RATE;
+const auto MAX_CATCH_UP_STEPS = 5;              // updates run in one frame before the rest are dropped
+
+// How often frames are drawn: in step with the display (VSYNC), as often as possible (UNCAPPED),
+// or at most TARGET_FRAME_RATE times a second (TARGET_FPS)
+enum class RenderPacing {VSYNC, UNCAPPED, TARGET_FPS};
+const auto RENDER_PACING = RenderPacing::VSYNC;
+const auto TARGET_FRAME_RATE = 144.0f;
+const auto FRAME_LIMIT_SPIN_TIME = 1500;        // microseconds spent spinning rather than sleeping before a frame
+const auto IDLE_TIMEOUT = 1000.0f;              // longest a state that only changes on input goes without updating (milliseconds)
+const auto IDLE_POLL_INTERVAL = 5;              // milliseconds between checks for input while a state is idle
+const auto USE_RENDER_THREAD = false;           // draw snapshots of the level on a separate thread (see RenderThread)
 
 /*---- Maze Properties ----*/
 
@@ -62,10 +74,16 @@ const auto FRIGHTENED_MODE_TIME = 7000;
 const auto ENEMY_DEATH_TIME = 100;
 const auto ENEMY_PEN_TIME = 5000;
 
+// How chasing and scattering enemies choose their next tile: EUCLIDEAN is the arcade rule (the neighbour
+// closest to the target in a straight line) and SHORTEST_PATH follows the maze's distance fields.
+// Dead enemies always return to the pen along the shortest path.
+enum class Targeting {EUCLIDEAN, SHORTEST_PATH};
+const auto ENEMY_TARGETING = Targeting::EUCLIDEAN;
+
 /*-------- States --------*/
 
 // Splash State
-const auto SPLASH_DISPLAY_TIME = 5.0;   // Seconds
+const auto ASSET_UPLOAD_BUDGET = sf::milliseconds(8);   // time spent creating loaded assets per frame
 const auto INTER_DISPLAY_TIME = 3.0;
 
 const auto PROGRESS_BAR_WIDTH = GAME_WIDTH/2;
@@ -83,13 +101,24 @@ const auto PROGRESS_BAR_OUTLINE_THICKNESS = 3;
 const auto PERCENTAGE_POSITION = PROGRESS_BAR_OUTLINE_POSITION + sf::Vector2f{0, 50};
 
 // Endless Level State
-const auto NUM_ROWS = 25;
+const auto NUM_ROWS = 25;                       // default size of the mazes made by the level editor (other mazes can be any size)
 const auto NUM_COLS = 23;
+const auto MAZE_POSITION = sf::Vector2f{23,50};
+const auto PLAY_AREA = sf::FloatRect{MAZE_POSITION, sf::Vector2f{GAME_WIDTH - 2*MAZE_POSITION.x, GAME_HEIGHT - MAZE_POSITION.y}};  // part of the screen showing the maze, which scrolls if the maze is larger
+const auto MAZE_CHUNK_SIZE = 16;                // tiles along each side of the blocks the maze is drawn in
+const auto NUM_ENEMIES = 4;                     // Blinky, Pinky, Inky and Clyde, followed by a swarm taking turns at their personalities
+
+// Profiler (F3 toggles the overlay and F4 writes a Chrome trace while playing a level)
+const auto PROFILER_NUM_FRAMES = 600;
+const auto PROFILER_REFRESH_TIME = 500.0f;    // milliseconds between overlay updates
+const auto PROFILER_OVERLAY_POSITION = sf::Vector2f{30, 80};
 
 // Level Editor State
 const auto GRID_POSITION = sf::Vector2f{45,45};
 const auto GRID_SPACING = 30.f;
-const auto GRID_SIZE = sf::Vector2f{NUM_COLS * GRID_SPACING, NUM_ROWS * GRID_SPACING};
+const auto GRID_SIZE = sf::Vector2f{NUM_COLS * GRID_SPACING, NUM_ROWS * GRID_SPACING};   // part of the screen showing the grid, which scrolls if the grid is larger
+const auto MIN_GRID_TILES = 10;                 // fewest rows or columns the grid can be shrunk to
+const auto MAX_GRID_TILES = 256;                // most rows or columns the grid can be grown to
 const auto LINK_LINE_THICKNESS = 3.f;
 const auto PI = 2*acos(0.0);
 
@@ -242,15 +271,22 @@ const auto LEVAN_POLKA_FILEPATH = "resources/audio/levan-polka.ogg";
 const auto DAMAGED_CODA_FILEPATH = "resources/audio/damaged-coda.ogg";
 const auto SANDSTORM_FILEPATH = "resources/audio/sandstorm.ogg";
 
-const auto PLAYLIST = std::vector<std::string>{"full metal",
-                                    "sandstorm",
-                                    "giorno",
-                                    "caramelldansen",
-                                    "megalovania",
-                                    "crab rave",
-                                    "deja vu",
-                                    "running in 90s",
-                                    "levan polka"};
+// Built-in sound effects and songs, which index the asset manager's audio directly
+enum class Sound {BUTTON_CLICK, SELECT_BUTTON, KEY, GATE_LINK, SUPER_PELLET, POWER_PELLET,
+                  GATE_BREAK, PLAYER_DIE, EAT_GHOST, BUTTON_ERROR, COUNT};
+
+enum class Song {COFFIN_DANCE, UNRAVEL, XUE_HUA_PIAO, GIORNO, CARAMELLDANSEN, MEGALOVANIA, FULL_METAL,
+                 CRAB_RAVE, DEJA_VU, RUNNING_IN_90S, RICK_ROLL, LEVAN_POLKA, DAMAGED_CODA, SANDSTORM, COUNT};
+
+const auto PLAYLIST = std::vector<Song>{Song::FULL_METAL,
+                                    Song::SANDSTORM,
+                                    Song::GIORNO,
+                                    Song::CARAMELLDANSEN,
+                                    Song::MEGALOVANIA,
+                                    Song::CRAB_RAVE,
+                                    Song::DEJA_VU,
+                                    Song::RUNNING_IN_90S,
+                                    Song::LEVAN_POLKA};
 
 // Mazes
 const auto CLASSIC_LAYOUT_FILEPATH = "resources/mazes/classic/layout.txt";
@@ -260,6 +296,10 @@ const auto CLASSIC_STARTPOS_FILEPATH = "resources/mazes/classic/start_positions.
 
 const auto MAZE_DIRECTORY = "resources/mazes/";
 const auto MAZE_LIST_FILEPATH = "resources/mazes/maze_list.txt";
+const auto MAZE_FILE_EXTENSION = ".maze";       // the binary form of a maze, imported from its text files
+const auto MAZE_FILE_TAG = "HQMZ";
+const auto MAZE_FILE_VERSION = 1;
+const auto MAZE_PREVIEW_CACHE_SIZE = 8;         // previews kept by the maze select screen (each is roughly 2MB of video memory)
 
 // High Scores
 const auto HIGH_SCORE_FILEPATH = "resources/highscores/highscores.txt";
@@ -267,5 +307,19 @@ const auto HIGH_SCORE_DIRECTORY = "resources/highscores/";
 
 const auto CREDITS_FILEPATH = "resources/credits.txt";
 
+// Profiler
+const auto PROFILER_TRACE_FILEPATH = "resources/profiler_trace.json";
+
+// Replays
+const auto LAST_REPLAY_FILEPATH = "resources/replays/last_level.replay";
+const auto REPLAY_TAG = "HQRP";
+const auto REPLAY_VERSION = char{1};
+const auto MAX_REPLAY_NAME_LENGTH = 256u;  // longer maze names are taken to mean that the file is corrupt
+
+// Asset pack
+const auto ASSET_PACK_FILEPATH = "resources/assets.pack";   // built by the AssetPacker tool; loose files are used if it is missing
+const auto ASSET_PACK_TAG = "HQPK";
+const auto ASSET_PACK_VERSION = 1;
+
 
 #endif
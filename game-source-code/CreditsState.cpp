@@ -16,19 +16,20 @@ void CreditsState::initialise()
     loadText(game_->assetManager);
     loadButtons(game_->assetManager);
     loadPageProgress(game_->assetManager);
+    loadLayer();
 
-    game_->assetManager.playSong("rick roll");
-    game_->assetManager.setLoop("rick roll", true);
+    game_->assetManager.playSong(Song::RICK_ROLL);
+    game_->assetManager.setLoop(Song::RICK_ROLL, true);
 }
 
 void CreditsState::processInput()
 {
     sf::Event event;
 
-    while (game_->window.pollEvent(event))
+    while (game_->inputManager.pollEvent(game_->window, event))
     {
         if (game_->inputManager.isExitRequest(event))
-            game_->window.close();
+            game_->closeWindow();
 
         if (event.type == sf::Event::Resized)
             game_->view = game_->inputManager.getLetterboxView(game_->view, event.size.width, event.size.height);
@@ -37,9 +38,9 @@ void CreditsState::processInput()
         {
             if (exitButton_.isHover(game_->window))
             {
-                game_->assetManager.playSound("button click");
+                game_->assetManager.playSound(Sound::BUTTON_CLICK);
                 game_->stateMachine.addState(make_unique<MainMenuState>(game_));
-                game_->assetManager.stopSong("rick roll");
+                game_->assetManager.stopSong(Song::RICK_ROLL);
             }
 
             if (rightButton_.isHover(game_->window))
@@ -63,18 +64,7 @@ void CreditsState::draw(float dt)
     game_->window.clear();
     game_->window.setView(game_->view);
 
-    game_->window.draw(bg);
-    game_->window.draw(title_);
-
-    for (const auto& line : pages_[pageNum_])
-            game_->window.draw(line);
-
-    game_->window.draw(pageDisplay_);
-
-    game_->window.draw(exitButton_);
-    game_->window.draw(leftButton_);
-    game_->window.draw(rightButton_);
-
+    game_->window.draw(layer_);
 
     game_->window.display();
 }
@@ -174,15 +164,16 @@ void CreditsState::nextPage()
 {
     if (pageNum_ == pages_.size() - 1)
     {
-        game_->assetManager.playSound("error");
+        game_->assetManager.playSound(Sound::BUTTON_ERROR);
     }
     else
     {
-        game_->assetManager.playSound("button click");
+        game_->assetManager.playSound(Sound::BUTTON_CLICK);
 
         pageNum_++;
         pageDisplay_.setString(to_string(pageNum_ + 1) + "/" + to_string(pages_.size()));
         pageDisplay_.setOrigin(pageDisplay_.getGlobalBounds().width/2, pageDisplay_.getGlobalBounds().height/2);
+        loadLayer();
     }
 }
 
@@ -190,14 +181,33 @@ void CreditsState::previousPage()
 {
     if (pageNum_ == 0)
     {
-        game_->assetManager.playSound("error");
+        game_->assetManager.playSound(Sound::BUTTON_ERROR);
     }
     else
     {
-        game_->assetManager.playSound("button click");
+        game_->assetManager.playSound(Sound::BUTTON_CLICK);
 
         pageNum_--;
         pageDisplay_.setString(to_string(pageNum_ + 1) + "/" + to_string(pages_.size()));
         pageDisplay_.setOrigin(pageDisplay_.getGlobalBounds().width/2, pageDisplay_.getGlobalBounds().height/2);
+        loadLayer();
     }
 }
+
+void CreditsState::loadLayer()
+{
+    // The layer holds the lines of the current page, so it is refilled whenever the page changes
+    layer_.clear();
+
+    layer_.add(bg);
+    layer_.add(title_);
+
+    for (const auto& line : pages_[pageNum_])
+        layer_.add(line);
+
+    layer_.add(pageDisplay_);
+
+    layer_.add(exitButton_);
+    layer_.add(leftButton_);
+    layer_.add(rightButton_);
+}
@@ -6,6 +6,7 @@
 #include "State.h"
 #include "GameLoop.h"
 #include "Button.h"
+#include "RenderLayer.h"
 
 class CreditsState: public State
 {
@@ -19,6 +20,7 @@ public:
     void processInput() override;
     void update(float dt) override;
     void draw(float dt) override;
+    float getIdleTimeout() const override {return IDLE_TIMEOUT;}
 
 private:
     gamePtr game_;
@@ -36,6 +38,8 @@ private:
     
     sf::Sprite bg;
 
+    RenderLayer layer_{SCREEN_AREA};
+
     int pageNum_ = 0;
 
     // Private helper functions
@@ -43,6 +47,7 @@ private:
     void loadText(AssetManager& assetManager);
     void loadButtons(AssetManager& assetManager);
     void loadPageProgress(AssetManager& assetManager);
+    void loadLayer();
 
     void nextPage();
     void previousPage();
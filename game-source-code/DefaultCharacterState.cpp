@@ -7,7 +7,7 @@ void DefaultCharacterState::update(float dt)
 {
     movePlayer(dt, player_->NormalSpeed(), player_, maze_);
 
-    player_->animate(dt, getTextureName());
+    player_->animate(dt, getLook());
 }
 
 void DefaultCharacterState::enter()
@@ -15,16 +15,16 @@ void DefaultCharacterState::enter()
    // player_->setDefaultTexture();
 }
 
-string DefaultCharacterState::getTextureName()
+Player::Look DefaultCharacterState::getLook()
 {
     if (player_->currentDir() == RIGHT)
-        return "right";
+        return Player::Look::RIGHT;
     if (player_->currentDir() == LEFT)
-        return "left";
+        return Player::Look::LEFT;
     if (player_->currentDir() == UP)
-        return "up";
+        return Player::Look::UP;
     if (player_->currentDir() == DOWN)
-        return "down";
+        return Player::Look::DOWN;
     
-    return "right";
+    return Player::Look::RIGHT;
 }
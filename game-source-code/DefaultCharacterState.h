@@ -39,7 +39,7 @@ class DefaultCharacterState : public PlayerMovingState
          *  speed in its normal mode as a parameter. It activates whichever tile it is
          *  on, which has different behaviour depending on the tile.
          *
-         *  Finally the function determines which textureKey to use based on its current
+         *  Finally the function determines which look to use based on its current
          *  direction, and calls the 'animate' function of the player.
          *
          *  \param dt, the time interval in milliseconds since the last function call
@@ -53,7 +53,7 @@ class DefaultCharacterState : public PlayerMovingState
         playerPtr  player_;
         mazePtr maze_;
 
-        string getTextureName();
+        Player::Look getLook();
 };
 
 #endif
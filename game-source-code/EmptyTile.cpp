@@ -1,9 +0,0 @@
-#include "EmptyTile.h"
-
-/*---------------------------------------------
- 
- For if we want to implement behaviour later...
- 
- Example: Animate the floor of the maze
- 
- ---------------------------------------------*/
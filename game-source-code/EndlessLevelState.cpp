@@ -7,6 +7,10 @@
 #include "Configuration.h"
 #include "DefaultCharacterState.h"
 #include "GameOverState.h"
+#include "Blinky.h"
+#include "Pinky.h"
+#include "Inky.h"
+#include "Clyde.h"
 #include <iostream>
 #include <utility>
 
@@ -15,21 +19,36 @@ EndlessLevelState::EndlessLevelState(gamePtr game, string mazeName, int lvlNumbe
     // error checking
 }
 
+EndlessLevelState::EndlessLevelState(gamePtr game, const Replay& replay):
+    game_{game}, mazeName_{replay.getMazeName()}, lvlNumber_{replay.getLevelNumber()}, replay_{replay}, isReplaying_{true}
+{
+}
+
 void EndlessLevelState::initialise()
 {
+    if (!isReplaying_)
+        replay_ = Replay{mazeName_, lvlNumber_, game_->endScore, static_cast<unsigned int>(game_->randomEngine())};
+
     loadMaze(game_->assetManager);
     loadCharacters(game_->assetManager);
-    loadInfoBar(game_->assetManager);
+    loadBoards(game_->assetManager);
+
+    // A headless game has nowhere to show the info bar
+    if (!game_->isHeadless)
+        loadInfoBar(game_->assetManager);
 }
 
 void EndlessLevelState::processInput()
 {
     sf::Event event;
 
-    while (game_->window.pollEvent(event))
+    while (game_->inputManager.pollEvent(game_->window, event))
     {
        if (game_->inputManager.isExitRequest(event))
-            game_->window.close();
+       {
+            saveReplay();
+            game_->closeWindow();
+       }
         
         if (event.type == sf::Event::Resized)
             game_->view = game_->inputManager.getLetterboxView(game_->view, event.size.width, event.size.height);
@@ -39,16 +58,16 @@ void EndlessLevelState::processInput()
             switch (event.key.code)
             {
             case sf::Keyboard::Right:
-                player_.Right();
+                recordInput(Replay::Input::RIGHT);
                 break;
             case sf::Keyboard::Left:
-                player_.Left();
+                recordInput(Replay::Input::LEFT);
                 break;
             case sf::Keyboard::Up:
-                player_.Up();
+                recordInput(Replay::Input::UP);
                  break;
             case sf::Keyboard::Down:
-                player_.Down();
+                recordInput(Replay::Input::DOWN);
                 break;
             case sf::Keyboard::O:
                 if (player_.livesLeft() > 1)
@@ -60,6 +79,14 @@ void EndlessLevelState::processInput()
                     soundBoard_.nextSong();
                 break;
 
+            case sf::Keyboard::F3:
+                game_->isProfilerVisible = !game_->isProfilerVisible;
+                break;
+
+            case sf::Keyboard::F4:
+                game_->profiler.writeChromeTrace(PROFILER_TRACE_FILEPATH);
+                break;
+
             default:
                 break;
             }
@@ -69,48 +96,72 @@ void EndlessLevelState::processInput()
 
 void EndlessLevelState::update(float dt)
 {
+    applyInputs();
+
+    tick_++;
+    if (!isReplaying_)
+        replay_.setLength(tick_);
+
     if (player_.livesLeft() > 1)
     {
         soundBoard_.checkSong();
     }
 
-    updateInfoBar();
+    auto& profiler = game_->profiler;
+
+    if (!game_->isHeadless)
+    {
+        auto zone = Profiler::Zone{profiler, "info bar"};
+        updateInfoBar();
 
-    player_.update(dt);
-    blinky_.update(dt);
-    pinky_.update(dt);
-    inky_.update(dt);
-    clyde_.update(dt);
+        if (game_->isProfilerVisible)
+            profilerOverlay_.update(profiler, dt);
+    }
 
-    maze_.update();
+    {
+        auto zone = Profiler::Zone{profiler, "player"};
+        player_.savePosition();
+        player_.update(dt);
+    }
+    {
+        auto zone = Profiler::Zone{profiler, "enemies"};
+        // Most enemies head for the player, so the paths to the player's tile are found once for all of them
+        maze_.setSharedTarget(player_.getCurrentTile());
+        enemies_.update(dt, profiler);
+    }
 
-    auto playerTile = maze_.getTile(player_.getSprite().getPosition());
+    auto playerPosition = player_.getSprite().getPosition();
 
-    PlayerEnemyInteraction(blinky_);
-    PlayerEnemyInteraction(inky_);
-    PlayerEnemyInteraction(pinky_);
-    PlayerEnemyInteraction(clyde_);
+    {
+        auto zone = Profiler::Zone{profiler, "interactions"};
+        // Only the enemies that shared a tile with the player during the update are looked at closely
+        collisionGrid_.clear();
+        for (auto i = 0; i < enemies_.size(); i++)
+            collisionGrid_.add(i, enemies_[i].getPreviousPosition(), enemies_[i].getPosition());
+
+        collisionGrid_.query(player_.getPreviousPosition(), player_.getPosition(), nearbyEnemies_);
+        for (auto i : nearbyEnemies_)
+            PlayerEnemyInteraction(enemies_[i]);
+    }
 
     if (player_.livesLeft() == 0)
     {
-        scoreBoard_.endGame();
-
         soundBoard_.gameOver();
 
-        game_->stateMachine.addState(make_unique<GameOverState>(game_, mazeName_, lvlNumber_));
+        endLevel(make_unique<GameOverState>(game_, mazeName_, lvlNumber_));
     }
 
-    playerTile->activate();
-    //maze_.activate(playerTile);
+    {
+        auto zone = Profiler::Zone{profiler, "maze"};
+        maze_.activate(playerPosition);
+    }
 
     if (maze_.isClear())
     {
-        scoreBoard_.endGame();
-
         soundBoard_.nextLevel();
 
         lvlNumber_++;
-        game_->stateMachine.addState(make_unique<IntermediateState>(game_,mazeName_,lvlNumber_));
+        endLevel(make_unique<IntermediateState>(game_,mazeName_,lvlNumber_));
     }
 
 }
@@ -118,40 +169,85 @@ void EndlessLevelState::update(float dt)
 void EndlessLevelState::draw(float dt)
 {
     game_->window.clear(sf::Color{20,25,27});
-    game_->window.setView(game_->view);
-    
+
+    // Characters are drawn part of the way through their last update (see Character::getSprite)
+    auto alpha = dt;
+    moveCamera(alpha);
+    game_->window.setView(camera_.getView(game_->view));
+
     game_->window.draw(background_);
     game_->window.draw(maze_);
-    game_->window.draw(player_.getSprite());
-    game_->window.draw(blinky_.getSprite());
-    game_->window.draw(pinky_.getSprite());
-    game_->window.draw(inky_.getSprite());
-    game_->window.draw(clyde_.getSprite());
+    auto playerSprite = player_.getSprite(alpha);
+    if (camera_.isVisible(playerSprite.getGlobalBounds()))
+        game_->window.draw(playerSprite);
+    batchEnemies(alpha);
+    game_->window.draw(enemyBatch_);
 
+    game_->window.setView(game_->view);
     game_->window.draw(scoreText_);
-    for (auto life : livesCounter_)
+    for (const auto& life : livesCounter_)
         game_->window.draw(life);
     game_->window.draw(mazeHeading_);
 
+    if (game_->isProfilerVisible)
+        game_->window.draw(profilerOverlay_);
+
     game_->window.display();
 }
 
+bool EndlessLevelState::snapshot(RenderSnapshot& snapshot, float dt)
+{
+    auto alpha = dt;
+    moveCamera(alpha);
+    snapshot.reset(sf::Color{20,25,27}, camera_.getView(game_->view));
+
+    const auto& renderer = maze_.getRenderer();
+    if (!mazeSnapshot_ || mazeSnapshot_->getRevision() != renderer.getRevision())
+        mazeSnapshot_ = make_shared<const MazeRenderer>(renderer);
+
+    snapshot.add(background_);
+    snapshot.add(mazeSnapshot_);
+    auto playerSprite = player_.getSprite(alpha);
+    if (camera_.isVisible(playerSprite.getGlobalBounds()))
+        snapshot.add(playerSprite);
+    batchEnemies(alpha);
+    snapshot.add(make_shared<const SpriteBatch>(enemyBatch_));
+
+    snapshot.setView(game_->view);
+    snapshot.add(scoreText_);
+    for (const auto& life : livesCounter_)
+        snapshot.add(life);
+    snapshot.add(mazeHeading_);
+
+    if (game_->isProfilerVisible)
+        snapshot.add(make_shared<const ProfilerOverlay>(profilerOverlay_));
+
+    return true;
+}
+
+bool EndlessLevelState::isOver() const
+{
+    return isOver_ || (isReplaying_ && tick_ >= replay_.getLength());
+}
+
+int EndlessLevelState::getScore() const
+{
+    return scoreBoard_.getCurrentScore();
+}
+
+int EndlessLevelState::getLivesLeft()
+{
+    return player_.livesLeft();
+}
+
 /*------------- Private helper functions -------------*/
 
 void EndlessLevelState::loadMaze(AssetManager& assetManager)
 {
     // Maze data elements
-    assetManager.loadLayout("classic layout", mazeName_);
-    assetManager.loadRotationMap("classic rotation", mazeName_);
-    assetManager.loadKeyMap("classic key map", mazeName_);
-    assetManager.loadStartPos("classic startPos", mazeName_);
+    assetManager.loadMaze("current maze", mazeName_);
 
-    Maze::Data mazeData;
-
-    mazeData.layout = assetManager.getLayout("classic layout");
-    mazeData.rotationMap = assetManager.getRotationMap("classic rotation");
-    mazeData.keyMap = assetManager.getKeyMap("classic key map");
-    mazeData.startPos = assetManager.getStartPos("classic startPos");
+    auto& mazeData = assetManager.getMaze("current maze");
 
     Maze::Textures mazeTextures;
 
@@ -168,18 +264,14 @@ void EndlessLevelState::loadMaze(AssetManager& assetManager)
     Maze::Observers mazeObservers;
 
     mazeObservers.player = &player_;
-    mazeObservers.enemies.push_back(&blinky_);
-    mazeObservers.enemies.push_back(&inky_);
-    mazeObservers.enemies.push_back(&pinky_);
-    mazeObservers.enemies.push_back(&clyde_);
+    mazeObservers.enemies.push_back(&enemies_);
 
     mazeObservers.scoreBoard = &scoreBoard_;
 
     mazeObservers.soundBoard = &soundBoard_;
 
-    maze_ = Maze{mazeData, mazeTextures, mazeObservers, sf::Vector2f{23,50}, TILE_LENGTH};//GAME_HEIGHT / mazeData.layout.size()};
-
-    nodes_ = maze_.getNodes();
+    maze_ = Maze{mazeData, mazeTextures, mazeObservers, MAZE_POSITION, TILE_LENGTH};//GAME_HEIGHT / mazeData.layout.size()};
+    collisionGrid_ = CollisionGrid{get<0>(maze_.getMazeBounds()), maze_.getTileLength()};
 }
 
 void EndlessLevelState::loadCharacters(AssetManager& assetManager)
@@ -208,21 +300,11 @@ void EndlessLevelState::loadCharacters(AssetManager& assetManager)
     player_sprites["kill down"] = assetManager.getTexture("kill down");
     player_sprites["kill super down"] = assetManager.getTexture("kill super down");
 
-    player_sprites["kill hit left"] = assetManager.getTexture("hit left");
-    player_sprites["kill hit right"] = assetManager.getTexture("hit right");
-    player_sprites["kill hit up"] = assetManager.getTexture("hit up");
-    player_sprites["kill hit down"] = assetManager.getTexture("hit down");
-
     player_sprites["hit super left"] = assetManager.getTexture("hit super left");
     player_sprites["hit super right"] = assetManager.getTexture("hit super right");
     player_sprites["hit super up"] = assetManager.getTexture("hit super up");
     player_sprites["hit super down"] = assetManager.getTexture("hit super down");
 
-    player_sprites["kill hit super left"] = assetManager.getTexture("hit super left");
-    player_sprites["kill hit super right"] = assetManager.getTexture("hit super right");
-    player_sprites["kill hit super up"] = assetManager.getTexture("hit super up");
-    player_sprites["kill hit super down"] = assetManager.getTexture("hit super down");
-
     player_sprites["dead"] = assetManager.getTexture("harambe dead");
 
     player_ = Player{player_sprites, maze_.getPlayerStart(), &maze_};
@@ -232,78 +314,136 @@ void EndlessLevelState::loadCharacters(AssetManager& assetManager)
     enemy_sprites["frightened"] = assetManager.getTexture("blue police");
     enemy_sprites["dead"] = assetManager.getTexture("police dead");
 
-    enemy_sprites["default"] = assetManager.getTexture("red police");
-    blinky_ = Blinky{enemy_sprites, maze_.getEnemyStarts()[0], &player_, &maze_};
+    // The police only differ in their default look, so they share the rest of their clips
+    auto police_clips = Enemy::Clips{enemy_sprites};
 
-    enemy_sprites["default"] = assetManager.getTexture("purple police");
-    pinky_ = Pinky{enemy_sprites, maze_.getEnemyStarts()[1], &player_, &maze_};
+    auto red_clips = police_clips.withDefault(assetManager.getTexture("red police"));
+    auto purple_clips = police_clips.withDefault(assetManager.getTexture("purple police"));
+    auto green_clips = police_clips.withDefault(assetManager.getTexture("green police"));
+    auto brown_clips = police_clips.withDefault(assetManager.getTexture("brown police"));
 
-    enemy_sprites["default"] = assetManager.getTexture("green police");
-    inky_ = Inky{enemy_sprites, maze_.getEnemyStarts()[2], &player_, &maze_, &blinky_};
+    player_.setLevelNumber(lvlNumber_);
 
-    enemy_sprites["default"] = assetManager.getTexture("brown police");
-    clyde_ = Clyde{enemy_sprites, maze_.getEnemyStarts()[3], &player_, &maze_};
+    // Blinky, Pinky, Inky and Clyde come first, and the rest of the swarm takes turns at each of their personalities
+    auto starts = maze_.getEnemyStarts();
+    Enemy* blinky = nullptr;
 
-    Character::setLevelNumber(lvlNumber_);
+    // A maze need not have any enemy starts, in which case the enemies start where the player does
+    if (starts.empty())
+        starts.push_back(maze_.getPlayerStart());
 
-    blinky_.addObserver(&scoreBoard_);
-    pinky_.addObserver(&scoreBoard_);
-    inky_.addObserver(&scoreBoard_);
-    clyde_.addObserver(&scoreBoard_);
-    blinky_.addObserver(&player_);
-    pinky_.addObserver(&player_);
-    inky_.addObserver(&player_);
-    clyde_.addObserver(&player_);
+    enemies_.clear();
 
-    blinky_.addObserver(&soundBoard_);
-    pinky_.addObserver(&soundBoard_);
-    inky_.addObserver(&soundBoard_);
-    clyde_.addObserver(&soundBoard_);
+    for (auto i = 0; i < NUM_ENEMIES; i++)
+    {
+        auto start = starts[i % starts.size()];
+
+        switch (i % 4)
+        {
+        case 0:
+            blinky = &enemies_.add(make_unique<Blinky>(red_clips, start, &player_, &maze_));
+            break;
+        case 1:
+            enemies_.add(make_unique<Pinky>(purple_clips, start, &player_, &maze_));
+            break;
+        case 2:
+            enemies_.add(make_unique<Inky>(green_clips, start, &player_, &maze_, blinky));
+            break;
+        default:
+            enemies_.add(make_unique<Clyde>(brown_clips, start, &player_, &maze_));
+            break;
+        }
 
-    player_.addObserver(&soundBoard_);
+        enemies_[i].setLevelNumber(lvlNumber_);
+        // Every enemy gets its own generator, derived from the level's seed
+        enemies_[i].seedRandom(replay_.getSeed() + i);
+    }
 
-    life_.setTexture(*assetManager.getTexture("harambe head"));
-    life_.setOrigin(assetManager.getTexture("harambe head")->getSize().x /2, assetManager.getTexture("harambe head")->getSize().y /2);
-    life_.setScale(1.9,1.9);
+    enemies_.addObserver(&scoreBoard_);
+    enemies_.addObserver(&player_);
+    enemies_.addObserver(&soundBoard_);
+
+    player_.addObserver(&soundBoard_);
 }
 
-void EndlessLevelState::loadInfoBar(AssetManager& assetManager)
+void EndlessLevelState::loadBoards(AssetManager& assetManager)
 {
     assetManager.loadHighScores(mazeName_);
 
     auto highscores = assetManager.getHighScores();
 
-    scoreBoard_ = Scoreboard{highscores};
+    scoreBoard_ = Scoreboard{highscores, replay_.getStartScore()};
+
+    soundBoard_ = Soundboard(game_);
+}
+
+void EndlessLevelState::loadInfoBar(AssetManager& assetManager)
+{
+    life_.setTexture(*assetManager.getTexture("harambe head"));
+    life_.setOrigin(assetManager.getTexture("harambe head")->getSize().x /2, assetManager.getTexture("harambe head")->getSize().y /2);
+    life_.setScale(1.9,1.9);
 
     scoreText_.setFont(*assetManager.getFont("fine 8-bit"));
     scoreText_.setOrigin(scoreText_.getGlobalBounds().left, scoreText_.getGlobalBounds().height/2.0f);
-    scoreText_.setPosition(get<0>(maze_.getMazeBounds()).x + 10, 20);
+    auto infoBarArea = getInfoBarArea();
+    scoreText_.setPosition(infoBarArea.left + 10, 20);
+    scoreText_.setFillColor(sf::Color(137,207,240));
+    scoreText_.setOutlineColor(sf::Color::Black);
+    scoreText_.setOutlineThickness(2.f);
 
     mazeHeading_.setFont(*assetManager.getFont("fine 8-bit"));
     mazeHeading_.setString(mazeName_);
     mazeHeading_.setOrigin(mazeHeading_.getGlobalBounds().width/2.0f, mazeHeading_.getGlobalBounds().height/2.0f);
-    mazeHeading_.setPosition(get<0>(maze_.getMazeBounds()).x + maze_.getWidth()/2, 25);
+    mazeHeading_.setPosition(infoBarArea.left + infoBarArea.width/2, 25);
     mazeHeading_.setFillColor(sf::Color(255,165,0));
     mazeHeading_.setOutlineColor(sf::Color::Black);
     mazeHeading_.setOutlineThickness(2.f);
     mazeHeading_.setScale(1.2,1.2);
 
+    profilerOverlay_ = ProfilerOverlay{*assetManager.getFont("fine 8-bit"), PROFILER_OVERLAY_POSITION};
+
     bgTexture_ = *assetManager.getTexture("grass");
     bgTexture_.setRepeated(true);
     background_.setTexture(bgTexture_);
     background_.setPosition(get<0>(maze_.getMazeBounds())+sf::Vector2f{10,10});
     background_.setTextureRect(sf::IntRect(get<0>(maze_.getMazeBounds()).x, get<0>(maze_.getMazeBounds()).y, maze_.getWidth()-20, maze_.getHeight()-20));
+}
 
-    soundBoard_ = Soundboard(game_);
+sf::FloatRect EndlessLevelState::getInfoBarArea() const
+{
+    // The part of the play area covered by the maze, which is all of it for a maze that scrolls
+    auto [topLeft, bottomRight] = maze_.getMazeBounds();
+    auto area = sf::FloatRect{};
+    PLAY_AREA.intersects(sf::FloatRect{topLeft, bottomRight - topLeft}, area);
+    return area;
+}
+
+void EndlessLevelState::batchEnemies(float alpha)
+{
+    enemyBatch_.clear();
+
+    for (auto& enemy : enemies_.getEnemies())
+    {
+        auto sprite = enemy->getSprite(alpha);
+        if (camera_.isVisible(sprite.getGlobalBounds()))
+            enemyBatch_.add(sprite);
+    }
+}
 
+void EndlessLevelState::moveCamera(float alpha)
+{
+    auto [topLeft, bottomRight] = maze_.getMazeBounds();
+    camera_.follow(player_.getSprite(alpha).getPosition(), sf::FloatRect{topLeft, bottomRight - topLeft});
 }
 
 void EndlessLevelState::PlayerEnemyInteraction(Enemy& enemy)
 {
-     auto enemyTile = enemy.getCurrentTile();
-     auto playerTile = player_.getCurrentTile();
+     // Characters collide if they end up on the same tile, or if they passed through each other during the update
+     auto isSameTile = (enemy.getCurrentTile() == player_.getCurrentTile());
+     auto isCrossing = CollisionGrid::isSweptCollision(player_.getPreviousPosition(), player_.getPosition(),
+                                                       enemy.getPreviousPosition(), enemy.getPosition(), maze_.getTileLength()/2);
 
-     if (!(playerTile == enemyTile))
+     if (!isSameTile && !isCrossing)
         return;
 
      if (!player_.isInteractive())
@@ -328,24 +468,90 @@ void EndlessLevelState::PlayerEnemyInteraction(Enemy& enemy)
 
 void EndlessLevelState::resetCharacters()
 {
-    blinky_.PlayerDead();
-    clyde_.PlayerDead();
-    inky_.PlayerDead();
-    pinky_.PlayerDead();
+    for (auto& enemy : enemies_.getEnemies())
+        enemy->PlayerDead();
 }
 
 void EndlessLevelState::updateInfoBar()
 {
-    scoreText_.setString("SCORE " + to_string(scoreBoard_.getCurrentScore()));
-    scoreText_.setFillColor(sf::Color(137,207,240));
-    scoreText_.setOutlineColor(sf::Color::Black);
-    scoreText_.setOutlineThickness(2.f);
+    // Setting the text's string makes SFML rebuild its glyphs, so it is only done when the score changes
+    if (scoreBoard_.getCurrentScore() != infoBarScore_)
+    {
+        infoBarScore_ = scoreBoard_.getCurrentScore();
+        scoreText_.setString("SCORE " + to_string(infoBarScore_));
+    }
 
-    livesCounter_.clear();
-    for (int l = 0; l<player_.livesLeft(); l++)
+    if (player_.livesLeft() != infoBarLives_)
     {
-        livesCounter_.push_back(life_);
-        livesCounter_[l].setPosition(sf::Vector2f{get<1>(maze_.getMazeBounds()).x-(l+1)*37,40});
+        infoBarLives_ = player_.livesLeft();
+
+        auto infoBarArea = getInfoBarArea();
+        livesCounter_.clear();
+        for (int l = 0; l<infoBarLives_; l++)
+        {
+            livesCounter_.push_back(life_);
+            livesCounter_[l].setPosition(sf::Vector2f{infoBarArea.left + infoBarArea.width-(l+1)*37,40});
+        }
     }
+}
+
+void EndlessLevelState::recordInput(Replay::Input input)
+{
+    // Keyboard input is ignored while replaying, the recorded input is used instead
+    if (isReplaying_)
+        return;
+
+    // The input is applied at the start of the next update, whether playing or replaying
+    replay_.record(tick_, input);
+}
+
+void EndlessLevelState::applyInputs()
+{
+    auto& events = replay_.getEvents();
+
+    while (nextInput_ < events.size() && events[nextInput_].tick <= tick_)
+    {
+        switch (events[nextInput_].input)
+        {
+        case Replay::Input::UP:
+            player_.Up();
+            break;
+        case Replay::Input::DOWN:
+            player_.Down();
+            break;
+        case Replay::Input::LEFT:
+            player_.Left();
+            break;
+        case Replay::Input::RIGHT:
+            player_.Right();
+            break;
+        default:
+            break;
+        }
+
+        nextInput_++;
+    }
+}
+
+void EndlessLevelState::endLevel(statePtr nextState)
+{
+    isOver_ = true;
+
+    // A replay only shows what happened, so it leaves the game that is watching it alone
+    if (isReplaying_)
+        return;
+
+    game_->endScore = scoreBoard_.getCurrentScore();
+
+    saveReplay();
+
+    game_->stateMachine.addState(move(nextState));
+}
+
+void EndlessLevelState::saveReplay()
+{
+    if (isReplaying_ || game_->isHeadless)
+        return;
 
+    game_->assetManager.writeReplay(replay_, LAST_REPLAY_FILEPATH);
 }
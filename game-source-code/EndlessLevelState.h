@@ -10,14 +10,17 @@
 
 #include "Player.h"
 #include "Enemy.h"
-#include "Blinky.h"
-#include "Pinky.h"
-#include "Inky.h"
-#include "Clyde.h"
+#include "EnemyRoster.h"
+#include "CollisionGrid.h"
 #include "Maze.h"
 
 #include "Scoreboard.h"
 #include "Soundboard.h"
+#include "Replay.h"
+#include "ProfilerOverlay.h"
+#include "RenderSnapshot.h"
+#include "Camera.h"
+#include "SpriteBatch.h"
 
 /** \class EndlessLevelState
  *  \brief A state which encapsulates the actual game in its entirety
@@ -43,6 +46,17 @@ public:
      */
     EndlessLevelState(gamePtr game, string mazeName, int lvlNumber = 1);
 
+    /** \brief EndlessLevelState Constructor for replaying a recorded level
+     *
+     *  The level is set up exactly as it was when it was recorded, and the recorded
+     *  input is used instead of the keyboard. A replayed level does not save a replay
+     *  or move on to another state when it ends.
+     *
+     *  \param game, a pointer to the game object
+     *  \param replay, the recording of the level
+     */
+    EndlessLevelState(gamePtr game, const Replay& replay);
+
     /** \brief Private members are initialised
      *
      *  The maze is loaded and constructed and the characters are loaded and constructed as well.
@@ -54,8 +68,9 @@ public:
 
     /** \brief Input from the keyboard is processed
      *
-     *  An exit request or key press is detected and action taken, such as moving the
-     *  player.
+     *  An exit request or key press is detected and action taken. Keys that move the
+     *  player are recorded in the level's replay, and applied at the start of the next
+     *  update so that the level can be reproduced exactly.
      */
     void processInput() override;
 
@@ -71,10 +86,51 @@ public:
     /** \brief All maze, character and score drawable objects are drawn
      *
      *  First the background is drawn, then the maze, then the characters, and finally
-     *  the score, maze title and number of lives left.
+     *  the score, maze title and number of lives left. A maze that is larger than the
+     *  play area scrolls to follow the player, and only the parts of it (and the
+     *  characters) that are in view are drawn.
      */
     void draw(float dt) override;
 
+    /** \brief Copies everything that draw() would draw into a snapshot
+     *
+     *  The maze is shared between snapshots, and only copied again once one of its tiles
+     *  has changed.
+     *  \return true, as the level can always be drawn from a snapshot
+     */
+    bool snapshot(RenderSnapshot& snapshot, float dt) override;
+
+    /** \brief Returns the player's current score
+     *
+     *  \return an integer, the current score
+     */
+    int getScore() const;
+
+    /** \brief Returns the number of lives the player has left
+     *
+     *  \return an integer, the number of lives left
+     */
+    int getLivesLeft();
+
+    /** \brief Checks whether the level has ended
+     *
+     *  \return true if the maze has been cleared, the player has run out of lives, or
+     *  the end of the replay has been reached, and false otherwise
+     */
+    bool isOver() const;
+
+    /** \brief Checks whether the maze has been cleared
+     *
+     *  \return true if all the food in the maze has been eaten, and false otherwise
+     */
+    bool isMazeClear() const {return maze_.isClear();}
+
+    /** \brief Returns the recording of the level so far
+     *
+     *  \return a reference to the level's replay
+     */
+    const Replay& getReplay() const {return replay_;}
+
 private:
     gamePtr game_;
     string mazeName_;
@@ -82,7 +138,8 @@ private:
     sf::Clock clock_;
 
     Maze maze_;
-    vector<sf::Vector2f> nodes_;
+    shared_ptr<const MazeRenderer> mazeSnapshot_;
+    Camera camera_{PLAY_AREA};
 
     Scoreboard scoreBoard_;
     Soundboard soundBoard_;
@@ -90,26 +147,43 @@ private:
     int songNumber = 0;
 
     Player player_;
-    Blinky blinky_;
-    Inky inky_;
-    Pinky pinky_;
-    Clyde clyde_;
+    EnemyRoster enemies_;
+    CollisionGrid collisionGrid_;
+    vector<int> nearbyEnemies_;
+    SpriteBatch enemyBatch_;
 
     sf::Text scoreText_;
     sf::Text mazeHeading_;
+    ProfilerOverlay profilerOverlay_;
     sf::Sprite life_;
     sf::Sprite background_;
     sf::Texture bgTexture_;
 
     vector<sf::Sprite> livesCounter_;
+    int infoBarScore_ = -1;     // the score and lives shown on the info bar, which is only rebuilt when they change
+    int infoBarLives_ = -1;
+
+    Replay replay_;
+    bool isReplaying_ = false;
+    bool isOver_ = false;
+    unsigned int tick_ = 0;
+    size_t nextInput_ = 0;
 
     // Private helper functions
     void loadMaze(AssetManager& assetManager);
     void loadCharacters(AssetManager& assetManager);
+    void loadBoards(AssetManager& assetManager);
     void loadInfoBar(AssetManager& assetManager);
+    sf::FloatRect getInfoBarArea() const;
+    void batchEnemies(float alpha);
+    void moveCamera(float alpha);
     void PlayerEnemyInteraction(Enemy& enemy);
     void resetCharacters();
     void updateInfoBar();
+    void recordInput(Replay::Input input);
+    void applyInputs();
+    void endLevel(statePtr nextState);
+    void saveReplay();
 };
 
 #endif
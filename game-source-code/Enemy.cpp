@@ -13,8 +13,8 @@
 #include "EnemyPenState.h"
 #include "EnemyFrozenState.h"
 
-Enemy::Enemy(map<string,texturePtr> textures, sf::Vector2f position, playerPtr player, mazePtr maze):
-    Character(textures, position, maze), player_{player}
+Enemy::Enemy(Clips clips, sf::Vector2f position, playerPtr player, mazePtr maze):
+    Character(position, maze), player_{player}, clips_{clips}
 {
 }
 
@@ -23,6 +23,84 @@ Enemy::~Enemy()
     //dtor
 }
 
+void Enemy::addCharState(charStatePtr state)
+{
+    Character::addCharState(state);
+    motion_->isChanging = true;
+}
+
+void Enemy::removeCharState()
+{
+    Character::removeCharState();
+    motion_->isChanging = true;
+}
+
+void Enemy::update(float dt)
+{
+    motion_->time += dt;
+
+    if (motion_->isDue(dt))
+        decide(dt);
+
+    motion_->step(dt);
+    applyMotion(dt);
+}
+
+void Enemy::decide(float dt)
+{
+    // The time of this update belongs to the state which is current once the changes are made
+    if (char_states_.empty())
+        addCharState(getCharState<EnemyScatterState>(this));
+    else if (is_adding || is_removing)
+        char_states_.top()->setTime(motion_->time - dt);
+
+    if (is_adding || is_removing)
+    {
+        updateCharState();
+        motion_->time = char_states_.top()->getTime() + dt;
+    }
+
+    motion_->isChanging = false;
+    char_states_.top()->setTime(motion_->time);
+    char_states_.top()->update(dt);
+    loadMotion();
+}
+
+void Enemy::applyMotion(float dt)
+{
+    position_ = motion_->position;
+    sprite_.setPosition(position_);
+    current_dir_ = motion_->direction;
+
+    if (motion_->isTeleported)
+        previous_position_ = position_;
+
+    if (motion_->isAnimated)
+        animate(dt, motion_->look);
+}
+
+void Enemy::setMotion(float speed, float timeLimit, Look look, bool isAnimated)
+{
+    motion_->speed = speed;
+    motion_->timeLimit = timeLimit;
+    motion_->look = look;
+    motion_->isAnimated = isAnimated;
+}
+
+void Enemy::stop()
+{
+    motion_->speed = 0.f;
+    motion_->isAnimated = false;
+}
+
+void Enemy::loadMotion()
+{
+    motion_->maze = maze_;
+    motion_->position = position_;
+    motion_->direction = current_dir_;
+    motion_->turn = future_dir_;
+}
+
 void Enemy::onNotify(Event event)
 {
     switch (event)
@@ -38,48 +116,17 @@ void Enemy::onNotify(Event event)
     }
 }
 
-void Enemy::animate(float dt, string textureKey)
+void Enemy::animate(float dt, Look look)
 {
-    auto tStep = 300;
-    int textureHeight = 32;
-    int textureWidth = 32;
-
-    animateTime+=dt;
-
-   // cout << animateTime << endl;
-    auto& currentTexture_ = stateTextures[textureKey];
-    auto numFrames = static_cast<int>(currentTexture_->getSize().x/textureWidth);
-    auto frame = static_cast<int>((animateTime/tStep) * numFrames) % numFrames;
-
-    auto rowNum = 0;
-
-    if (textureKey != "dead")
-    {
-        if (current_dir_ == DOWN)
-            rowNum = 0;
-        if (current_dir_ == LEFT)
-            rowNum = 1;
-        if (current_dir_ == RIGHT)
-            rowNum = 2;
-        if (current_dir_ == UP)
-            rowNum = 3;
-    }
-
-
-    auto selectRect =  sf::IntRect(frame * textureWidth, rowNum*textureHeight, textureWidth, textureHeight);
-
-    sprite_.setTexture(*currentTexture_);
-    sprite_.setTextureRect(selectRect);
-
-    sprite_.setOrigin(sf::Vector2f{static_cast<float>(textureWidth/2), static_cast<float>(textureHeight/2)});
-    sprite_.setScale(1.6f,1.6f);
+    animator_.play(sprite_, clips_.get(look, current_dir_), dt);
+    animator_.setScale(sprite_, 1.6f);
 }
 
 void Enemy::FrightenedMode()
 {
     if (char_states_.size()>1)
         removeCharState();
-    addCharState(std::make_unique<EnemyFrightenedState>(this, maze_));
+    addCharState(getCharState<EnemyFrightenedState>(this));
     frightened_ = true;
 }
 
@@ -96,12 +143,12 @@ void Enemy::DisableFrightenedMode()
 
 void Enemy::ChaseMode()
 {
-    addCharState(std::make_unique<EnemyChaseState>(this, maze_));
+    addCharState(getCharState<EnemyChaseState>(this));
 }
 
 void Enemy::ScatterMode()
 {
-    addCharState(std::make_unique<EnemyScatterState>(this, maze_));
+    addCharState(getCharState<EnemyScatterState>(this));
 }
 
 void Enemy::reset()
@@ -111,28 +158,28 @@ void Enemy::reset()
 
     interactive_ = true;
 
-    position_ = default_position_;
-    char_states_ = {};
-    addCharState(std::make_unique<EnemyScatterState>(this, maze_));
+    teleport(default_position_);
+    char_states_.clear();
+    addCharState(getCharState<EnemyScatterState>(this));
     current_dir_ = default_dir_;
 
 }
 
 void Enemy::PlayerDead()
 {
-    addCharState(std::make_unique<EnemyFrozenState>(this, maze_));
+    addCharState(getCharState<EnemyFrozenState>(this));
 }
 
 void Enemy::die()
 {
     DisableFrightenedMode();
-    addCharState(std::make_unique<EnemyDeadState>(this, maze_));
+    addCharState(getCharState<EnemyDeadState>(this));
     notify(Observer::Event::GHOST_EATEN);
 }
 
 void Enemy::penState()
 {
-    addCharState(std::make_unique<EnemyPenState>(this, maze_));
+    addCharState(getCharState<EnemyPenState>(this));
 }
 
 sf::Vector2f Enemy::getPenPosition()
@@ -181,3 +228,147 @@ float Enemy::FrightenedSpeed()
 
     return speed;
 }
+
+void Enemy::seedRandom(unsigned int seed)
+{
+    randomEngine_.seed(seed);
+}
+
+int Enemy::randomIndex(int size)
+{
+    return randomEngine_() % size;
+}
+
+/*------------------ Clips -------------------*/
+
+Enemy::Clips::Clips():
+    clips_(4*static_cast<size_t>(Look::COUNT))
+{
+}
+
+Enemy::Clips::Clips(map<string,texturePtr> textures):
+    Clips()
+{
+    setLook(Look::DEFAULT, textures["default"]);
+    setLook(Look::FRIGHTENED, textures["frightened"]);
+    setLook(Look::DEAD, textures["dead"]);
+}
+
+Enemy::Clips Enemy::Clips::withDefault(texturePtr texture) const
+{
+    auto clips = *this;
+    clips.setLook(Look::DEFAULT, texture);
+    return clips;
+}
+
+const Enemy::clipPtr& Enemy::Clips::get(Look look, sf::Vector2f direction) const
+{
+    auto row = 0;
+
+    if (look != Look::DEAD)
+    {
+        if (direction == LEFT)
+            row = 1;
+        if (direction == RIGHT)
+            row = 2;
+        if (direction == UP)
+            row = 3;
+    }
+
+    return clips_[4*static_cast<size_t>(look) + row];
+}
+
+void Enemy::Clips::setLook(Look look, texturePtr texture)
+{
+    const auto tStep = 300.f;
+
+    for (auto row = 0; row < 4; row++)
+        clips_[4*static_cast<size_t>(look) + row] = Animator::makeClip(texture, sf::Vector2i{32,32}, row, tStep);
+}
+
+/*------------------ Motion -------------------*/
+
+bool Enemy::Motion::isDue(float dt) const
+{
+    if (isChanging || time >= timeLimit)
+        return true;
+
+    if (speed <= 0.f)
+        return false;
+
+    auto tile = maze->getTilePosition(position);
+    auto distanceToCentre = getDistanceToCentre(tile);
+
+    return isOnEdge(tile) || (distanceToCentre >= 0 && distanceToCentre < getDistance(dt));
+}
+
+void Enemy::Motion::step(float dt)
+{
+    isTeleported = false;
+
+    if (speed <= 0.f)
+        return;
+
+    auto distance = getDistance(dt);
+    auto tile = maze->getTilePosition(position);
+    auto distanceToCentre = getDistanceToCentre(tile);
+
+    auto topLeft = get<0>(maze->getMazeBounds());
+    auto bottomRight = get<1>(maze->getMazeBounds());
+    auto tileLength = maze->getTileLength();
+
+    if ((tile.x == topLeft.x+0.5f*tileLength && turn == LEFT)
+        || (tile.x == bottomRight.x-0.5f*tileLength && turn == RIGHT)
+        || (tile.y == topLeft.y+0.5f*tileLength && turn == UP)
+        || (tile.y == bottomRight.y-0.5f*tileLength && turn == DOWN))
+    {
+        auto moveDistance = sf::Vector2f{};
+
+        if (turn.x == 0.f)
+            moveDistance = turn*(-1.f)*(maze->getHeight()-tileLength);
+        else
+            moveDistance = turn*(-1.f)*(maze->getWidth()-tileLength);
+
+        if (maze->isOpenNode(position + moveDistance))
+        {
+            position += moveDistance;
+            isTeleported = true;
+        }
+
+        direction = turn;
+        return;
+    }
+
+    if (distanceToCentre >= 0 && distanceToCentre < distance)
+    {
+        position += direction*distanceToCentre;
+        position += turn*(distance-distanceToCentre);
+        direction = turn;
+    } else
+    {
+        position += direction*distance;
+    }
+}
+
+float Enemy::Motion::getDistance(float dt) const
+{
+    return floor((speed*dt)/MIN_CHANGE)*MIN_CHANGE;
+}
+
+float Enemy::Motion::getDistanceToCentre(sf::Vector2f tile) const
+{
+    if (direction == UP || direction == DOWN)
+        return direction.y*tile.y - direction.y*position.y;
+
+    return direction.x*tile.x - direction.x*position.x;
+}
+
+bool Enemy::Motion::isOnEdge(sf::Vector2f tile) const
+{
+    auto topLeft = get<0>(maze->getMazeBounds());
+    auto bottomRight = get<1>(maze->getMazeBounds());
+    auto halfTile = 0.5f*maze->getTileLength();
+
+    return tile.x == topLeft.x+halfTile || tile.x == bottomRight.x-halfTile
+        || tile.y == topLeft.y+halfTile || tile.y == bottomRight.y-halfTile;
+}
@@ -19,6 +19,7 @@
 #include <vector>
 #include <ctime>
 #include <memory>
+#include <random>
 
 /** \class Enemy
  *  \brief A class derived mainly from the Character class
@@ -26,8 +27,9 @@
  *  The Enemy is inherited from the Character class, which provides
  *  the basic movement and directional functionality. This derived class
  *  acts as state machine, maintaining and updating the various states a
- *  an Enemy can be in, and then delegating the required motion and updates
- *  to the current state. However, it is also a base class for different
+ *  an Enemy can be in, and then delegating the decisions (when to change
+ *  state and where to turn) to the current state. In between decisions, the
+ *  Enemy carries on according to its Motion, without calling on its state. However, it is also a base class for different
  *  types of Enemies, which vary in their behaviour. As such, these differences
  *  are handled by the derived classes, and all common functionality is handled
  *  by this class.
@@ -43,6 +45,103 @@ class Enemy  : public Character, public Observer, public Subject
     public:
         typedef Player* playerPtr; /**< Alias for a pointer to a Player, to improve readability */
 
+        /** \brief The different looks of an enemy, each of which has its own texture
+         *
+         *  The textures are looked up by name ("default", "frightened" and "dead") once, when
+         *  the enemy is constructed, and are indexed by this enumeration afterwards.
+         */
+        enum class Look {DEFAULT, FRIGHTENED, DEAD, COUNT};
+
+        /** \brief The animation clips of an enemy
+         *
+         *  Each look has a clip for every direction the enemy can face, which are the rows of
+         *  its sprite sheet (down, left, right and up). The clips are made once, and all of the
+         *  enemies share the frightened and dead clips (see withDefault).
+         */
+        class Clips
+        {
+            public:
+                /** \brief Default constructor, which gives no clips */
+                Clips();
+
+                /** \brief Makes the clips from a map of textures
+                 *
+                 *  \param textures, a map<string,texturePtr> which maps "default", "frightened"
+                 *  and "dead" to texture pointers
+                 */
+                Clips(map<string,texturePtr> textures);
+
+                /** \brief Returns a copy of the clips with a different default look
+                 *
+                 *  The frightened and dead clips are shared with the copy, rather than being made again.
+                 *
+                 *  \param texture, the texture of the default look
+                 *  \returns The new set of clips
+                 */
+                Clips withDefault(texturePtr texture) const;
+
+                /** \brief Returns the clip of a look
+                 *
+                 *  \param look, the look of the enemy
+                 *  \param direction, the direction the enemy is facing
+                 *  \returns The clip, which is null if its texture was not given
+                 */
+                const clipPtr& get(Look look, sf::Vector2f direction) const;
+
+            private:
+                vector<clipPtr> clips_; // four rows for each look
+
+                void setLook(Look look, texturePtr texture);
+        };
+
+        /** \brief The data an enemy needs on every tick, kept apart from its states
+         *
+         *  An enemy only needs its state to decide something: when the time in its state
+         *  runs out, when it reaches the centre of a tile (where it may turn), or when it
+         *  is on the edge of the maze (where it may wrap around). On every other tick it
+         *  simply carries on, which needs nothing but this data. An EnemyRoster keeps the
+         *  motion of all of its enemies in one array, so that they are all stepped in one
+         *  loop, and only the enemies which are due to decide call on their states.
+         */
+        struct Motion
+        {
+            const Maze* maze = nullptr; /**< The maze the enemy moves in */
+            sf::Vector2f position; /**< The position, which is copied to the enemy after each step */
+            sf::Vector2f direction; /**< The current direction */
+            sf::Vector2f turn; /**< The future direction, which is taken at the centre of the next tile */
+            float speed = 0.f; /**< The speed in pixels per millisecond, which is 0 while the enemy is still */
+            float time = 0.f; /**< The time spent in the current state */
+            float timeLimit = 0.f; /**< The time at which the current state decides what to do next, which is 0 until the first state is entered */
+            Look look = Look::DEFAULT; /**< The look to animate the enemy with */
+            bool isAnimated = false; /**< Whether the enemy is animated while it is in its state */
+            bool isChanging = false; /**< Whether a state change is waiting to be made */
+            bool isTeleported = false; /**< Whether the last step wrapped around the edge of the maze */
+
+            /** \brief Checks if the enemy needs its state to decide something before it is stepped
+             *
+             *  \param dt, the time interval in milliseconds of the step
+             *  \returns true if a state change is waiting, the time in the state has run out, or
+             *  the step reaches the centre of a tile or starts on the edge of the maze
+             */
+            bool isDue(float dt) const;
+
+            /** \brief Moves the enemy on by one time interval
+             *
+             *  The enemy moves in its current direction, taking its future direction as it passes
+             *  through the centre of a tile, and wraps around to the opposite side of the maze if
+             *  it heads out of the maze and the tile there is open. The maze is only read, so the
+             *  motions of many enemies can be stepped together.
+             *
+             *  \param dt, the time interval in milliseconds since the last step
+             */
+            void step(float dt);
+
+        private:
+            float getDistance(float dt) const;
+            float getDistanceToCentre(sf::Vector2f tile) const;
+            bool isOnEdge(sf::Vector2f tile) const;
+        };
+
         /** \brief Default constructor for Enemy class */
         Enemy(){}
 
@@ -51,17 +150,29 @@ class Enemy  : public Character, public Observer, public Subject
          *  Initialises an Enemy object by creating aCharacter object using the Character constructor,
          *  as well as some of its own data members such as the pointer to the Player.
          *
-         *  \param textures, a map<string,texturePtr> which maps a label to a texture pointer
+         *  \param clips, the animation clips of the enemy (which can be given as a map of textures)
          *  \param position, an sf::Vector2f which contains the x and y coordinates of the
          *  default and initial position of the player
          *  \param player, a pointer to the Player
          *  \param maze, a pointer to the Maze
          */
-        Enemy(map<string,texturePtr> textures, sf::Vector2f position, playerPtr player, mazePtr maze);
+        Enemy(Clips clips, sf::Vector2f position, playerPtr player, mazePtr maze);
+
+        /** \brief Enemies are not copied, since an enemy's motion may be kept by its roster */
+        Enemy(const Enemy&) = delete;
+
+        /** \brief Enemies are not copied, since an enemy's motion may be kept by its roster */
+        Enemy& operator=(const Enemy&) = delete;
 
         /** \brief Default destructor for Enemy class */
         virtual ~Enemy();
 
+        /** \brief Marks a state to be added, which the enemy decides on at its next update (see Character) */
+        void addCharState(charStatePtr state) override;
+
+        /** \brief Marks the current state to be removed, which the enemy decides on at its next update (see Character) */
+        void removeCharState() override;
+
         /** \brief Sets the future direction vector
          *
          *  The future direction vector is updated to the direction vector specified by dir. If dir is
@@ -191,24 +302,68 @@ class Enemy  : public Character, public Observer, public Subject
 
         /** \brief Updates the Enemy based on a time interval, dt
          *
-         *  This function is not given an implementation, instead leaving it to the derived classes
-         *  to provide an implementation.
+         *  The time in the current state is advanced, and if the enemy is due to decide
+         *  something (see Motion::isDue()), it does so (see decide()). The enemy is then
+         *  moved on and animated. An EnemyRoster does the same for all of its enemies at once.
+         *
+         *  \param dt, the time increment in milliseconds since the last call to update
+         */
+        void update(float dt) override;
+
+        /** \brief Makes any state changes and lets the current state decide what to do
+         *
+         *  If the state stack is empty, a Scatter State is added to it. The time in the state
+         *  that is left is kept by that state, and the time in the state that is entered is
+         *  taken up from where it left off. The current state then changes state if its time
+         *  has run out, or else chooses the enemy's next direction. Since states may move the
+         *  enemy (see reset()), its motion is taken from it again afterwards.
+         *
+         *  \param dt, the time increment in milliseconds since the last update
+         */
+        void decide(float dt);
+
+        /** \brief Moves and animates the enemy according to its motion, after it has been stepped
+         *
+         *  \param dt, the time increment in milliseconds since the last update
+         */
+        void applyMotion(float dt);
+
+        /** \brief Sets how the enemy moves while it is in its current state
+         *
+         *  This is called by each state when it is entered.
+         *
+         *  \param speed, the speed in pixels per millisecond, or 0 if the enemy is still
+         *  \param timeLimit, the time after which the state decides what to do next
+         *  \param look, the look to animate the enemy with
+         *  \param isAnimated, whether the enemy is animated at all
+         */
+        void setMotion(float speed, float timeLimit, Look look, bool isAnimated = true);
+
+        /** \brief Keeps the enemy still, without animating it, until it enters its next state */
+        void stop();
+
+        /** \brief Returns the enemy's motion
          *
+         *  \returns a reference to the motion, wherever it is kept
          */
-        virtual void update(float dt) = 0;
+        Motion& getMotion() {return *motion_;}
+
+        /** \brief Keeps the enemy's motion somewhere else, e.g. in the array of an EnemyRoster
+         *
+         *  \param motion, the motion to use, which must already hold the enemy's motion and outlive its use
+         */
+        void useMotion(Motion& motion) {motion_ = &motion;}
 
         /** \brief Animates the Enemy based on a time interval, dt
          *
-         *  This function overrides the abstract function provided by the base class, Character.
          *  The enemy sprite is animated, based on the time interval provided. The animate function
-         *  is called with 'textureKey' as a parameter. This is a key to the map of textures. Using
-         *  the selected texture, the current direction and the time passed in, it determines which
-         *  texture to use, as well as which frame in the texture to select.
+         *  is called with the look to show, which along with the current direction selects one of
+         *  the precomputed clips. The sprite is only changed when the clip or frame to show changes.
          *
          *  \param dt, the time increment in milliseconds since the function was last called
-         *  \param textureKey, a string which contains a key linked to a texture pointer
+         *  \param look, the look of the enemy
          */
-        virtual void animate(float dt, string textureKey) override;
+        void animate(float dt, Look look);
 
         /** \brief Returns the chase target
          *
@@ -224,12 +379,34 @@ class Enemy  : public Character, public Observer, public Subject
          */
         virtual sf::Vector2f getScatterTarget() = 0;
 
+        /** \brief Returns the name of the enemy's personality, e.g. to label it in the profiler
+         *
+         *  \returns a string literal, which outlives every enemy
+         */
+        virtual const char* getName() const = 0;
+
         /** \brief Returns the Default position of the enemy
          *
          *  \returns an sf::Vector2f containing the x and y coordinates of the enemy's default position.
          */
         virtual sf::Vector2f getPenPosition();
 
+        /** \brief Seeds the enemy's random number generator
+         *
+         *  Each enemy has its own generator, so that a level can be reproduced exactly
+         *  from its seed (see Replay).
+         *
+         *  \param seed, the seed of the random number generator
+         */
+        void seedRandom(unsigned int seed);
+
+        /** \brief Returns a random index into a list of the given size
+         *
+         *  \param size, the size of the list
+         *  \returns a random integer from 0 to size-1
+         */
+        int randomIndex(int size);
+
     protected:
 
         playerPtr player_;
@@ -239,9 +416,12 @@ class Enemy  : public Character, public Observer, public Subject
         sf::Vector2f default_dir_;
 
     private:
+        minstd_rand randomEngine_;
+        Clips clips_;
+        Motion ownMotion_;
+        Motion* motion_ = &ownMotion_;
 
-
-
+        void loadMotion();
 };
 
 #endif // ENEMY_H
@@ -5,17 +5,14 @@ EnemyChaseState::EnemyChaseState(enemyPtr enemy, mazePtr maze) : EnemyMovingStat
 
 void EnemyChaseState::update(float dt)
 {
-    timeInState_ += dt;
         if (timeInState_ >= CHASE_MODE_TIMES[0])
         {
             enemy_->ScatterMode();
+            enemy_->stop();
             return;
         }
 
     enemy_->setFutureDir(findNextMove(enemy_->getChaseTarget()));
-    moveEnemy(dt, enemy_->ChaseSpeed());
-
-    enemy_->animate(dt, "default");
 }
 
 void EnemyChaseState::enter()
@@ -23,5 +20,7 @@ void EnemyChaseState::enter()
     enemy_->reverseDir();
     if (!enemy_->isInteractive())
         enemy_->toggleInteractivity();
+
+    enemy_->setMotion(enemy_->ChaseSpeed(), CHASE_MODE_TIMES[0], Enemy::Look::DEFAULT);
 }
 
@@ -33,20 +33,17 @@ class EnemyChaseState : public EnemyMovingState
         /** \brief Destructor for EnemyChaseState */
         virtual ~EnemyChaseState() {}
 
-        /** \brief Updates the enemy by moving towards the Chase Target and animates the enemy accordingly
+        /** \brief Decides the enemy's next move towards the Chase Target
          *
-         *  This function increments its own time in the state by the value dt.
+         *  This is only called when the enemy is due to decide (see Enemy::Motion::isDue()).
          *  If the time for the Chase state, defined in the Configuration header file, has
-         *  passed, the state is removed, and the enemy is set to be in Scatter Mode
-         *  again, using the enemy's ScatterMode() function.
+         *  passed, the enemy is set to be in Scatter Mode again, using the enemy's
+         *  ScatterMode() function.
          *
          *  The next move is found by finding an available neighbouring node which
          *  minimises the distance between the current tile and the chase target.
          *
-         *  The function also determines which textureKey to use based on its current
-         *  direction, and calls the 'animate' function of the enemy.
-         *
-         *  \param dt, the time interval in milliseconds since the last function call
+         *  \param dt, the time interval in milliseconds since the last update
          */
         void update(float dt) override;
 
@@ -54,14 +51,13 @@ class EnemyChaseState : public EnemyMovingState
          *
          *  By checking if the Enemy is interactive, and calling the toggleInteractivity()
          *  function if not, the Enemy is set to be interactive. The current direction is
-         *  also reversed.
+         *  also reversed, and the enemy moves at its chase speed with its default look.
          */
         void enter() override;
 
     protected:
 
     private:
-        float timeInState_ = 0;
 
 
 };
@@ -4,6 +4,7 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <limits>
 
 EnemyDeadState::EnemyDeadState(enemyPtr enemy, mazePtr maze) : EnemyMovingState(enemy, maze) {}
 
@@ -13,17 +14,18 @@ void EnemyDeadState::update(float dt)
     {
         enemy_->removeCharState();
         enemy_->penState();
+        enemy_->stop();
         return;
     }
 
-    enemy_->setFutureDir(findNextMove(enemy_->getPenPosition()));
-    moveEnemy(dt, SCATTER_MODE_SPEED*3.5);
-
-    enemy_->animate(dt, "frightened");
+    enemy_->setFutureDir(findShortestMove(enemy_->getPenPosition()));
 }
 
 void EnemyDeadState::enter()
 {
     if (enemy_->isInteractive())
         enemy_->toggleInteractivity();
+
+    // Dead enemies head home at the next tile, however long that takes
+    enemy_->setMotion(SCATTER_MODE_SPEED*3.5, numeric_limits<float>::infinity(), Enemy::Look::FRIGHTENED);
 }
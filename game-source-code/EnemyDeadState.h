@@ -34,29 +34,29 @@ class EnemyDeadState: public EnemyMovingState
         /** \brief Destructor for EnemyDeadState */
         virtual ~EnemyDeadState() {}
 
-        /** \brief Returns to default position and animated Enemy based on a time interval dt
+        /** \brief Decides the Enemy's next move back to its default position
          *
-         *  In this state, the target tile is set to the Enemy's default position and the
-         *  speed is set to 3.5 times the normal speed. The Enemy is also non-interactive.
+         *  In this state, the target tile is set to the Enemy's default position, which is
+         *  reached along the shortest path through the maze. The Enemy is also non-interactive.
          *  Upon reaching the target tile, the Enemy will remove the current state and
          *  enter Pen State using penState().
          *
-         *  The function determines which textureKey to use based on its current
-         *  direction, and calls the 'animate' function of the Enemy.
+         *  This is only called when the enemy is due to decide (see Enemy::Motion::isDue()),
+         *  which it is at the centre of every tile.
          *
-         *  \param dt, the time interval in milliseconds since the last function call
+         *  \param dt, the time interval in milliseconds since the last update
          */
         void update(float dt) override;
 
         /** \brief Disables interactivity of the Enemy upon entering the state
          *
          *  By checking if the Enemy is interactive, and calling the toggleInteractivity()
-         *  function if so, the Enemy is set to be non-interactive.
+         *  function if so, the Enemy is set to be non-interactive. It moves at 3.5 times
+         *  the normal speed, with its frightened look.
          */
         void enter() override;
 
     private:
-        float timeInState_ = 0;
 };
 
 #endif
@@ -5,23 +5,20 @@ EnemyFrightenedState::EnemyFrightenedState(enemyPtr enemy, mazePtr maze) : Enemy
 
 void EnemyFrightenedState::update(float dt)
 {
-    timeInState_ += dt;
-
         if (timeInState_ >= FRIGHTENED_MODE_TIME)
         {
             enemy_->DisableFrightenedMode();
         }
 
     enemy_->setFutureDir(findRandomMove());
-    moveEnemy(dt, enemy_->FrightenedSpeed());
-
-    enemy_->animate(dt, "frightened");
 }
 
 void EnemyFrightenedState::enter()
 {
     if (!enemy_->isInteractive())
         enemy_->toggleInteractivity();
+
+    enemy_->setMotion(enemy_->FrightenedSpeed(), FRIGHTENED_MODE_TIME, Enemy::Look::FRIGHTENED);
 }
 
 
@@ -29,7 +26,7 @@ sf::Vector2f EnemyFrightenedState::findRandomMove()
 {
     auto valid_tiles = lookAround();
 
-    auto adj_tile = valid_tiles.at(rand()%valid_tiles.size());
+    auto adj_tile = valid_tiles.at(enemy_->randomIndex(valid_tiles.size()));
 
     return (adj_tile - enemy_->getCurrentTile())/float{TILE_LENGTH};
 }
@@ -32,20 +32,16 @@ class EnemyFrightenedState : public EnemyMovingState
         /** \brief Destructor for EnemyFrightenedState */
         virtual ~EnemyFrightenedState() {}
 
-        /** \brief Updates the enemy by moving randomly and animates the enemy accordingly
+        /** \brief Decides the enemy's next move at random
          *
-         *  This function increments its own time in the state by the value dt.
+         *  This is only called when the enemy is due to decide (see Enemy::Motion::isDue()).
          *  If the time for the Frightened state, defined in the Configuration header file, has
          *  passed, the state is removed, and the enemy reverts to the previous state.
          *
          *  By using the findRandomMove() function, the valid moves are searched and a random
-         *  move is selected. The enemy is then updated to move in the direction of the
-         *  random move, at its specified frightened state speed.
+         *  move is selected, which the enemy takes at its frightened state speed.
          *
-         *  The function also determines which textureKey to use based on its current
-         *  direction, and calls the 'animate' function of the enemy.
-         *
-         *  \param dt, the time interval in milliseconds since the last function call
+         *  \param dt, the time interval in milliseconds since the last update
          */
         void update(float dt) override;
 
@@ -59,7 +55,6 @@ class EnemyFrightenedState : public EnemyMovingState
     protected:
 
     private:
-        float timeInState_ = 0;
 
         sf::Vector2f findRandomMove();
 };
@@ -10,7 +10,6 @@ EnemyFrozenState::EnemyFrozenState(enemyPtr enemy, mazePtr maze) : enemy_{enemy}
 
 void EnemyFrozenState::update(float dt)
 {
-    timeInState_ += dt;
     if (timeInState_ >= DEATH_TIME)
     {
         enemy_->reset();
@@ -19,4 +18,5 @@ void EnemyFrozenState::update(float dt)
 
 void EnemyFrozenState::enter()
 {
+    enemy_->setMotion(0.f, DEATH_TIME, Enemy::Look::DEFAULT, false);
 }
@@ -45,6 +45,8 @@ class EnemyFrozenState: public CharacterStopState
          *  \param dt, the time interval in milliseconds since the last function call
          */
         void update(float dt) override;
+
+        /** \brief Keeps the Enemy still, without animating it, for the time it is frozen */
         void enter() override;
 
     protected:
@@ -53,7 +55,6 @@ class EnemyFrozenState: public CharacterStopState
     private:
         enemyPtr  enemy_;
         mazePtr maze_;
-        float timeInState_ = 0;
 };
 
 #endif
@@ -1,6 +1,5 @@
 #include "EnemyMovingState.h"
 #include "Enemy.h"
-#include "GateTile.h"
 
 #include <iostream>
 #include <SFML/Graphics.hpp>
@@ -20,75 +19,17 @@ void EnemyMovingState::enter()
 
 }
 
-void EnemyMovingState::moveEnemy(float dt, float speed)
+sf::Vector2f EnemyMovingState::findNextMove(sf::Vector2f target)
 {
-    float distance = floor((speed*dt)/MIN_CHANGE)*MIN_CHANGE;
-
-    auto current_block = enemy_->getCurrentTile();
-
-    float distance_to_node = 0;
-
-    auto position = enemy_->getSprite().getPosition();
-
-    auto direction = enemy_->futureDir();
-
-    if (enemy_->currentDir() == UP || enemy_->currentDir() == DOWN)
-    {
-        distance_to_node = enemy_->currentDir().y * current_block.y - enemy_->currentDir().y * position.y;
-    } else
-    {
-        distance_to_node = enemy_->currentDir().x * current_block.x  - enemy_->currentDir().x * position.x;
-    }
-
-    auto topLeft = get<0>(maze_->getMazeBounds());
-    auto bottomRight = get<1>(maze_->getMazeBounds());
-    auto mazeSize = bottomRight - topLeft;
-
-    if ((current_block.x == topLeft.x+0.5f*maze_->getTileLength() && (enemy_->futureDir()==LEFT))
-        || (current_block.x == bottomRight.x-0.5f*maze_->getTileLength() && enemy_->futureDir()==RIGHT)
-        || (current_block.y == topLeft.y+0.5f*maze_->getTileLength() && enemy_->futureDir()==UP)
-        || (current_block.y == bottomRight.y-0.5f*maze_->getTileLength() && enemy_->futureDir()==DOWN))
-    {
-
-        auto moveDistance = sf::Vector2f{};
-
-        if (enemy_->futureDir().x == 0.f)
-            moveDistance = enemy_->futureDir()*(-1.f)*(maze_->getHeight()-maze_->getTileLength());
-        else
-            moveDistance = enemy_->futureDir()*(-1.f)*(maze_->getWidth()-maze_->getTileLength());
-
-        auto isValidNode = maze_->getTile(position + moveDistance)->isNode();
-
-        if (isValidNode)
-        {
-            enemy_->updateDir();
-            enemy_->moveCharacter(moveDistance);
-        } else if (enemy_->futureDir() != enemy_->currentDir())
-        {
-            enemy_->updateDir();
-        }
-        return;
-    }
+        if (ENEMY_TARGETING == Targeting::SHORTEST_PATH)
+            return findShortestMove(target);
 
-    if ((distance_to_node>=0)&&(distance_to_node<distance))
-    {
-        enemy_->moveCharacter(enemy_->currentDir()*distance_to_node);
-
-        enemy_->moveCharacter(enemy_->futureDir()*(distance-distance_to_node));
-
-        enemy_->updateDir();
-
-    } else
-    {
-        enemy_->moveCharacter(enemy_->currentDir()*distance);
-    }
+        return findClosestMove(target);
 }
 
-sf::Vector2f EnemyMovingState::findNextMove(sf::Vector2f target)
+sf::Vector2f EnemyMovingState::findClosestMove(sf::Vector2f target)
 {
 
-        GateTile::isNode(false);
-        auto nodes = maze_->getNodes();
         auto distances = std::vector<double> {};
 
         auto valid_tiles = lookAround();
@@ -108,25 +49,42 @@ sf::Vector2f EnemyMovingState::findNextMove(sf::Vector2f target)
 
 
 
+}
+
+sf::Vector2f EnemyMovingState::findShortestMove(sf::Vector2f target)
+{
+        auto valid_tiles = lookAround();
+        auto best_tile = valid_tiles.end();
+        auto best_length = -1;
+
+        for (auto tile = valid_tiles.begin(); tile != valid_tiles.end(); tile++)
+        {
+            auto length = maze_->getPathLength(*tile, target);
+
+            if (length >= 0 && (best_length < 0 || length < best_length))
+            {
+                best_tile = tile;
+                best_length = length;
+            }
+        }
+
+        // The target cannot be reached from here (e.g. it is behind a gate), so head towards it instead
+        if (best_tile == valid_tiles.end())
+            return findClosestMove(target);
+
+        return (*best_tile - enemy_->getCurrentTile())/float{maze_->getTileLength()};
 }
 
 std::vector<sf::Vector2f> EnemyMovingState::lookAround()
 {
-    GateTile::isNode(false);
-    auto nodes = maze_->getNodes();
     auto compass = std::vector<sf::Vector2f>{UP,RIGHT,DOWN,LEFT};
-    auto adj_tile = sf::Vector2f{0,0};
+    auto current_tile = enemy_->getCurrentTile();
     auto valid_tiles = std::vector<sf::Vector2f>{};
 
     for (sf::Vector2f d : compass)
     {
-        if (float{-1}*enemy_->currentDir() != d)
-        {
-            adj_tile = enemy_->getCurrentTile() + d*float{maze_->getTileLength()};
-
-            if (std::find(nodes.begin(),nodes.end(),adj_tile) != nodes.end())
-                valid_tiles.push_back(adj_tile);
-        }
+        if (float{-1}*enemy_->currentDir() != d && maze_->isNeighbourNode(current_tile, d))
+            valid_tiles.push_back(current_tile + d*float{maze_->getTileLength()});
     }
 
     if (valid_tiles.empty())
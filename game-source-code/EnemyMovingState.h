@@ -18,9 +18,9 @@
  *  a base class which will be inherited by different Enemy states.
  *  It is an abstract class which has no implementation of its public
  *  members, and the interface is inherited by its derived classes.
- *  However, this class provides a common 'moveEnemy' function which
- *  will be common to all derived classes, since movement mechanics of the
- *  enemy is always the same but differs in destination.
+ *  However, this class provides the common functions which find the
+ *  next move towards a target, since the movement mechanics of the enemy
+ *  are always the same (see Enemy::Motion) but differ in destination.
  */
 class EnemyMovingState: public CharacterState
 {
@@ -48,8 +48,9 @@ class EnemyMovingState: public CharacterState
 
     protected:
 
-        void moveEnemy(float dt, float speed);
         sf::Vector2f findNextMove(sf::Vector2f target);
+        sf::Vector2f findClosestMove(sf::Vector2f target);
+        sf::Vector2f findShortestMove(sf::Vector2f target);
         std::vector<sf::Vector2f> lookAround();
 
         enemyPtr enemy_;
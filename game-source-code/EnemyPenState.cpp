@@ -10,17 +10,16 @@ EnemyPenState::EnemyPenState(enemyPtr enemy, mazePtr maze) : enemy_{enemy}, maze
 
 void EnemyPenState::update(float dt)
 {
-    timeInState_ += dt;
     if (timeInState_ >= ENEMY_PEN_TIME)
     {
+        // The pen is left for good, so that it is never uncovered again when a later state is removed
+        enemy_->removeCharState();
         enemy_->ScatterMode();
         enemy_->toggleInteractivity();
     }
-
-    enemy_->animate(dt, "dead");
 }
 
 void EnemyPenState::enter()
 {
-
+    enemy_->setMotion(0.f, ENEMY_PEN_TIME, Enemy::Look::DEAD);
 }
@@ -16,9 +16,7 @@
  *  This class is derived from the CharacterStopState class, and represents
  *  the state of the enemy after dying. The behaviour of this state is that
  *  the enemy remains inactive and stationary for a short period of time.
- *  Like other Character States, this state class has functionality to update
- *  the Enemy itself. However, only animations are updated since the Enemy
- *  does not move in this state.
+ *  The Enemy is still animated, but does not move in this state.
  */
 class EnemyPenState: public CharacterStopState
 {
@@ -40,20 +38,18 @@ class EnemyPenState: public CharacterStopState
         /** \brief Destructor for EnemyPenState */
         virtual ~EnemyPenState() {}
 
-        /** \brief Updates the Enemy Animation based on a time interval dt
+        /** \brief Leaves the pen once the time in it has run out
          *
-         *  This function increments its own time in the state by the value dt.
+         *  This is only called when the enemy is due to decide (see Enemy::Motion::isDue()).
          *  If the time for the Pen state, defined in the Configuration header file, has
          *  passed, the state is removed, and the enemy is set to be in Scatter Mode
          *  again, using the enemy's ScatterMode() function.
          *
-         *  The function determines which textureKey to use based on its current
-         *  direction, and calls the 'animate' function of the enemy.
-         *
-         *  \param dt, the time interval in milliseconds since the last function call
+         *  \param dt, the time interval in milliseconds since the last update
          */
         void update(float dt) override;
 
+        /** \brief Keeps the Enemy still, animated with its dead look, for the time it is in the pen */
         void enter() override;
 
     protected:
@@ -62,7 +58,6 @@ class EnemyPenState: public CharacterStopState
     private:
         enemyPtr  enemy_;
         mazePtr maze_;
-        float timeInState_ = 0;
 };
 
 #endif
@@ -0,0 +1,51 @@
+#include "EnemyRoster.h"
+
+Enemy& EnemyRoster::add(enemyPtr enemy)
+{
+    motions_.push_back(enemy->getMotion());
+    enemies_.push_back(move(enemy));
+
+    // The motions may have been moved, so every enemy is pointed at its own again
+    for (auto i = 0u; i < enemies_.size(); i++)
+        enemies_[i]->useMotion(motions_[i]);
+
+    return *enemies_.back();
+}
+
+void EnemyRoster::addObserver(Observer* observer)
+{
+    for (auto& enemy : enemies_)
+        enemy->addObserver(observer);
+}
+
+void EnemyRoster::update(float dt, Profiler& profiler)
+{
+    for (auto i = 0u; i < motions_.size(); i++)
+    {
+        motions_[i].time += dt;
+
+        if (motions_[i].isDue(dt))
+        {
+            auto zone = Profiler::Zone{profiler, enemies_[i]->getName()};
+            enemies_[i]->decide(dt);
+        }
+    }
+
+    {
+        auto zone = Profiler::Zone{profiler, "enemy motion"};
+        for (auto& motion : motions_)
+            motion.step(dt);
+    }
+
+    for (auto& enemy : enemies_)
+    {
+        enemy->savePosition();
+        enemy->applyMotion(dt);
+    }
+}
+
+void EnemyRoster::onNotify(Event event)
+{
+    for (auto& enemy : enemies_)
+        enemy->onNotify(event);
+}
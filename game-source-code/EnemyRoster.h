@@ -0,0 +1,74 @@
+#ifndef ENEMY_ROSTER_H
+#define ENEMY_ROSTER_H
+
+/// \file EnemyRoster.h
+/// \brief Contains the class definition for the "EnemyRoster" class
+
+#include "Enemy.h"
+#include "Observer.h"
+#include "Profiler.h"
+
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+/// \class EnemyRoster
+/// \brief All of the enemies in a level, which can be of any number
+///
+/// The targeting personality of each enemy is given by its type (Blinky chases the player, Pinky ambushes, Inky flanks and Clyde keeps his distance), so a level can be given any mix of them. The roster observes the maze on behalf of all of its enemies, so that the maze's tiles notify a single observer however many enemies there are.
+///
+/// The roster keeps the motion of every enemy (its position, direction, speed and the time in its state, see Enemy::Motion) in one array. On each update, the enemies which are due to decide something (a state change, or a turn at the centre of a tile) call on their states, and then every motion is stepped in one loop which only reads the maze. Most enemies are between tiles on most ticks, so a large swarm is mostly moved without a virtual call.
+
+class EnemyRoster : public Observer
+{
+public:
+    typedef unique_ptr<Enemy> enemyPtr; /**\typedef for a unique pointer to an Enemy, to improve readability */
+
+    /// Default constructor
+    EnemyRoster() {}
+
+    /// Remove every enemy
+    void clear() {enemies_.clear(); motions_.clear();}
+
+    /// Add an enemy to the roster
+    ///
+    /// Enemies are updated in the order in which they are added. Their addresses do not change, so enemies may refer to each other (see Inky)
+    /// @param enemy a unique pointer to the enemy
+    /// \return a reference to the enemy
+    Enemy& add(enemyPtr enemy);
+
+    /// Get the number of enemies
+    /// \return the size of the roster
+    int size() const {return enemies_.size();}
+
+    /// Get one of the enemies
+    /// @param index the position of the enemy in the roster
+    /// \return a reference to the enemy
+    Enemy& operator[](int index) {return *enemies_[index];}
+
+    /// Get all of the enemies, e.g. to loop over them
+    /// \return a constant reference to the vector of enemies
+    const vector<enemyPtr>& getEnemies() const {return enemies_;}
+
+    /// Make an observer observe every enemy
+    /// @param observer a pointer to the observer
+    void addObserver(Observer* observer);
+
+    /// Update every enemy, keeping each one's previous position for interpolation
+    ///
+    /// This has the same effect as updating each enemy on its own (see Enemy::update()), except that every enemy decides before any of them moves. Each enemy's decisions are recorded as a zone named after it, so that a slow enemy stands out in the profiler, and the stepping of all of them as one "enemy motion" zone
+    /// @param dt the elapsed time in milliseconds
+    /// @param profiler the profiler to record the updates in
+    void update(float dt, Profiler& profiler);
+
+    /// Pass an event from the maze on to every enemy
+    /// @param event the event which the maze sent a notification of
+    void onNotify(Event event) override;
+
+private:
+    vector<enemyPtr> enemies_;
+    vector<Enemy::Motion> motions_; // the motion of each enemy, in the same order
+};
+
+#endif
@@ -6,19 +6,15 @@ EnemyScatterState::EnemyScatterState(enemyPtr  enemy, mazePtr maze) : EnemyMovin
 
 void EnemyScatterState::update(float dt)
 {
-    timeInState_ += dt;
-
         if (timeInState_ >= SCATTER_MODE_TIMES[0])
         {
             enemy_->removeCharState();
             enemy_->ChaseMode();
+            enemy_->stop();
             return;
         }
 
         enemy_->setFutureDir(findNextMove(enemy_->getScatterTarget()));
-        moveEnemy(dt, enemy_->ScatterSpeed());
-
-        enemy_->animate(dt, "default");
 }
 
 void EnemyScatterState::enter()
@@ -27,5 +23,6 @@ void EnemyScatterState::enter()
         enemy_->toggleInteractivity();
 
     enemy_->reverseDir();
+    enemy_->setMotion(enemy_->ScatterSpeed(), SCATTER_MODE_TIMES[0], Enemy::Look::DEFAULT);
 }
 
@@ -31,9 +31,9 @@ class EnemyScatterState : public EnemyMovingState
         /** \brief Destructor for EnemyScatterState */
         virtual ~EnemyScatterState() {}
 
-        /** \brief Updates the enemy by moving towards the Scatter Target and animates the enemy accordingly
+        /** \brief Decides the enemy's next move towards the Scatter Target
          *
-         *  This function increments its own time in the state by the value dt.
+         *  This is only called when the enemy is due to decide (see Enemy::Motion::isDue()).
          *  If the time for the Scatter state, defined in the Configuration header file, has
          *  passed, the state is removed, and the enemy is set to be in Chase Mode
          *  again, using the enemy's ChaseMode() function.
@@ -41,10 +41,7 @@ class EnemyScatterState : public EnemyMovingState
          *  The next move is found by finding an available neighbouring node which
          *  minimises the distance between the current tile and the scatter target.
          *
-         *  The function also determines which textureKey to use based on its current
-         *  direction, and calls the 'animate' function of the enemy.
-         *
-         *  \param dt, the time interval in milliseconds since the last function call
+         *  \param dt, the time interval in milliseconds since the last update
          */
         void update(float dt) override;
 
@@ -52,12 +49,11 @@ class EnemyScatterState : public EnemyMovingState
          *
          *  By checking if the Enemy is interactive, and calling the toggleInteractivity()
          *  function if not, the Enemy is set to be interactive. The current direction is
-         *  also reversed.
+         *  also reversed, and the enemy moves at its scatter speed with its default look.
          */
         void enter() override;
 
     private:
-        float timeInState_ = 0;
 
 };
 
@@ -1,4 +1,5 @@
 #include "FileReader.h"
+#include "Configuration.h"
 #include <iostream>
 void FileReader::readFile(vector<string>& layout, const string& pathToFile)
 {
@@ -92,6 +93,90 @@ void FileReader::readFile(vector<pair<string,int>>& highScores,  const string& p
     file_.close();
 }
 
+void FileReader::readFile(Replay& replay, const string& pathToFile)
+{
+    replay = Replay{};
+
+    file_.open(pathToFile, ifstream::in | ifstream::binary);
+
+    if (!file_.is_open())
+    {
+        cout << "FILE FAILED TO OPEN" << endl;
+        return;
+    }
+
+    char tag[4];
+    file_.read(tag, 4);
+
+    if (!file_ || string(tag, 4) != REPLAY_TAG || file_.get() != REPLAY_VERSION)
+    {
+        file_.close();
+        return;
+    }
+
+    auto nameLength = 0u;
+    auto lvlNumber = 0u;
+    auto startScore = 0u;
+    auto seed = 0u;
+    auto length = 0u;
+    auto numEvents = 0u;
+
+    if (!readNumber(nameLength) || nameLength > MAX_REPLAY_NAME_LENGTH)
+    {
+        file_.close();
+        return;
+    }
+
+    auto mazeName = string(nameLength, ' ');
+    file_.read(&mazeName[0], nameLength);
+
+    if (!file_)
+    {
+        file_.close();
+        return;
+    }
+
+    if (!readNumber(lvlNumber) || !readNumber(startScore) || !readNumber(seed) || !readNumber(length) ||
+        !readNumber(numEvents))
+    {
+        file_.close();
+        return;
+    }
+
+    auto loaded = Replay{mazeName, static_cast<int>(lvlNumber), static_cast<int>(startScore), seed};
+    auto tick = 0u;
+
+    for (auto i = 0u; i < numEvents; i++)
+    {
+        auto delta = 0u;
+
+        if (!readNumber(delta))
+            break;
+
+        tick += delta;
+        auto input = file_.get();
+
+        // Any byte beyond the last input can only come from a damaged file
+        if (!file_ || input < 0 || input > static_cast<int>(Replay::Input::RIGHT))
+        {
+            file_.close();
+            return;
+        }
+
+        loaded.record(tick, static_cast<Replay::Input>(input));
+    }
+
+    if (file_)
+    {
+        loaded.setLength(length);
+        replay = loaded;
+    }
+
+    file_.close();
+}
+
+/*------------- Private helper functions -------------*/
+
 void FileReader::openFile(const string& pathToFile)
 {
     file_.open(pathToFile);
@@ -100,3 +185,26 @@ void FileReader::openFile(const string& pathToFile)
         cout << "FILE FAILED TO OPEN" << endl;
 }
 
+bool FileReader::readNumber(unsigned int& number)
+{
+    number = 0;
+
+    for (auto shift = 0; shift < 32; shift += 7)
+    {
+        auto byte = file_.get();
+
+        if (!file_)
+            return false;
+
+        // The fifth byte only has room for the top four bits of the number
+        if (shift == 28 && (byte & 0x70))
+            return false;
+
+        number |= static_cast<unsigned int>(byte & 0x7F) << shift;
+
+        if (!(byte & 0x80))
+            return true;
+    }
+
+    return false;
+}
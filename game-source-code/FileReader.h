@@ -12,6 +12,8 @@
 #include <sstream>
 #include <utility>
 
+#include "Replay.h"
+
 using namespace std;
 
 /** \class FileReader
@@ -64,6 +66,16 @@ public:
      */
     void readFile(vector<pair<string,int>>& highScores,  const string& pathToFile) ;
 
+    /** \brief Overloaded function to read a file
+     *
+     *  Reads a replay written by FileWriter. If the file cannot be opened or is not a valid
+     *  replay, the replay given is left empty (with a length of zero).
+     *
+     *  \param replay, a reference to the replay to fill in
+     *  \param pathToFile, the path to the file which needs to be read
+     */
+    void readFile(Replay& replay, const string& pathToFile);
+
 
 
 private:
@@ -71,6 +83,7 @@ private:
 
     // Private helper functions
     void openFile(const string& pathToFile);
+    bool readNumber(unsigned int& number);
 
 };
 
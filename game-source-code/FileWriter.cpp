@@ -1,5 +1,7 @@
 #include "FileWriter.h"
 
+#include "Configuration.h"
+
 void FileWriter::writeFile(string& mazeName, const string& pathToFile)
 {
     file_.open(pathToFile, ofstream::app);
@@ -63,4 +65,63 @@ void FileWriter::writeFile(vector<pair<string,int>>& highScores, const string& p
     file_.close();
 }
 
+bool FileWriter::writeFile(const Replay& replay, const string& pathToFile)
+{
+    // The replays folder is not shipped with the game, so it is made the first time a replay is saved
+    auto folder = filesystem::path{pathToFile}.parent_path();
+    auto error = error_code{};
+    if (!folder.empty())
+        filesystem::create_directories(folder, error);
+
+    file_.open(pathToFile, ofstream::out | ofstream::trunc | ofstream::binary);
+
+    if (!file_.is_open())
+    {
+        cout << "FILE FAILED TO OPEN" << endl;
+        return false;
+    }
+
+    file_.write(REPLAY_TAG, 4);
+    file_.put(REPLAY_VERSION);
+
+    writeNumber(replay.getMazeName().size());
+    file_.write(replay.getMazeName().data(), replay.getMazeName().size());
+
+    writeNumber(replay.getLevelNumber());
+    writeNumber(replay.getStartScore());
+    writeNumber(replay.getSeed());
+    writeNumber(replay.getLength());
+    writeNumber(replay.getEvents().size());
+
+    auto previousTick = 0u;
+
+    for (auto& event : replay.getEvents())
+    {
+        writeNumber(event.tick - previousTick);
+        file_.put(static_cast<char>(event.input));
+        previousTick = event.tick;
+    }
+
+    file_.flush();
+    auto isWritten = file_.good();
+    file_.close();
+
+    if (!isWritten)
+        cout << "FILE FAILED TO WRITE" << endl;
+
+    return isWritten;
+}
+
+/*------------- Private helper functions -------------*/
+
+void FileWriter::writeNumber(unsigned int number)
+{
+    // Seven bits at a time, least significant first, with the top bit set on all but the last byte
+    while (number >= 0x80)
+    {
+        file_.put(static_cast<char>((number & 0x7F) | 0x80));
+        number >>= 7;
+    }
 
+    file_.put(static_cast<char>(number));
+}
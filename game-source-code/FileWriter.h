@@ -11,6 +11,10 @@
 #include <fstream>
 #include <sstream>
 #include <utility>
+#include <filesystem>
+#include <iostream>
+
+#include "Replay.h"
 
 using namespace std;
 
@@ -70,12 +74,28 @@ public:
      */
     void writeFile(vector<pair<string,int>>& highScores,  const string& pathToFile) ;
 
+    /** \brief Overloaded function to write to a file
+     *
+     *  Writes the replay in a compact binary format: a "HQRP" tag and version byte, followed by
+     *  the maze name, level number, start score, seed, length and inputs. Whole numbers are
+     *  written as variable length integers, and each input is stored as the number of ticks since
+     *  the previous input followed by a single byte.
+     *
+     *  Any missing folders in the path are created first.
+     *
+     *  \param replay, a reference to the replay
+     *  \param pathToFile, the path to the file which needs to be written to
+     *  \return true if the whole replay was written
+     */
+    bool writeFile(const Replay& replay, const string& pathToFile);
+
 
 private:
 	ofstream file_;
 
     // Private helper functions
     void openFile(const string& pathToFile);
+    void writeNumber(unsigned int number);
 
 };
 
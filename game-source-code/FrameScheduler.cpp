@@ -0,0 +1,76 @@
+#include "FrameScheduler.h"
+
+#include <thread>
+
+FrameScheduler::FrameScheduler(float updateStep, int maxCatchUpSteps):
+    updateStep_us_{static_cast<long long>(updateStep*1000 + 0.5f)},
+    updateStep_{updateStep},
+    maxCatchUpSteps_{maxCatchUpSteps}
+{
+}
+
+void FrameScheduler::setPacing(RenderPacing pacing, float targetFrameRate)
+{
+    pacing_ = pacing;
+    framePeriod_us_ = (targetFrameRate > 0) ? static_cast<long long>(1000000/targetFrameRate) : 0;
+}
+
+void FrameScheduler::beginFrame()
+{
+    auto now = clock::now();
+
+    if (!isStarted_)
+    {
+        previousTime_ = now;
+        isStarted_ = true;
+    }
+
+    lag_us_ += chrono::duration_cast<chrono::microseconds>(now - previousTime_).count();
+    previousTime_ = now;
+    frameStart_ = now;
+    stepsThisFrame_ = 0;
+}
+
+bool FrameScheduler::shouldUpdate()
+{
+    if (lag_us_ < updateStep_us_)
+    {
+        isFullCatchUp_ = false;
+        return false;
+    }
+
+    if (stepsThisFrame_ >= maxCatchUpSteps_ && !isFullCatchUp_)
+    {
+        // Too far behind to catch up, so give up on the whole steps that are left
+        auto dropped = lag_us_ / updateStep_us_;
+        droppedSteps_ += dropped;
+        lag_us_ -= dropped * updateStep_us_;
+        return false;
+    }
+
+    lag_us_ -= updateStep_us_;
+    stepsThisFrame_++;
+    return true;
+}
+
+float FrameScheduler::getAlpha() const
+{
+    return static_cast<float>(lag_us_) / updateStep_us_;
+}
+
+void FrameScheduler::waitForNextFrame()
+{
+    if (pacing_ != RenderPacing::TARGET_FPS || framePeriod_us_ <= 0)
+        return;
+
+    auto deadline = frameStart_ + chrono::microseconds{framePeriod_us_};
+
+    // Sleeping can overshoot by a millisecond or two, so sleep for most of the wait and spin for the rest
+    auto sleepUntil = deadline - chrono::microseconds{FRAME_LIMIT_SPIN_TIME};
+
+    if (clock::now() < sleepUntil)
+        this_thread::sleep_until(sleepUntil);
+
+    while (clock::now() < deadline)
+        this_thread::yield();
+}
@@ -0,0 +1,84 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+/// \file FrameScheduler.h
+/// \brief Contains the class definition for the "FrameScheduler" class
+
+#include "Configuration.h"
+
+#include <chrono>
+
+using namespace std;
+
+/// \class FrameScheduler
+/// \brief Decides how many fixed updates to run each frame, and paces how often frames are drawn
+///
+/// Time is measured in microseconds, so the lag between the game's clock and real time accumulates without rounding. Each frame runs as many fixed update steps as the lag allows, up to a maximum. If the game falls further behind than that (e.g. after the window is dragged or a long load), the extra steps are dropped and counted rather than run, which prevents the game from spiralling into ever longer frames. What is left of the lag gives the interpolation alpha passed to draw.
+///
+/// Drawing is paced separately from updating: frames can be drawn as fast as possible, held to the display's refresh rate by vertical sync, or limited to a target frame rate by sleeping for most of the wait and spinning for the rest.
+
+class FrameScheduler
+{
+public:
+    /// Constructor
+    /// @param updateStep the fixed time step of each update (milliseconds)
+    /// @param maxCatchUpSteps the maximum number of updates to run in one frame
+    FrameScheduler(float updateStep = MS_PER_FRAME, int maxCatchUpSteps = MAX_CATCH_UP_STEPS);
+
+    /// Set how frames are paced
+    /// @param pacing vsync, uncapped or a target frame rate
+    /// @param targetFrameRate the frame rate to limit drawing to, when the pacing is RenderPacing::TARGET_FPS
+    void setPacing(RenderPacing pacing, float targetFrameRate = TARGET_FRAME_RATE);
+
+    /// Get how frames are paced
+    /// \return the render pacing
+    RenderPacing getPacing() const {return pacing_;}
+
+    /// Start a frame, adding the real time that has passed since the previous frame to the lag
+    void beginFrame();
+
+    /// Query whether another update step should be run in this frame, and consume its time if so
+    ///
+    /// Call this in a loop: while (scheduler.shouldUpdate()) update(scheduler.getUpdateStep());
+    /// \return true if an update should be run, and false once the game has caught up or the maximum number of steps has been run
+    bool shouldUpdate();
+
+    /// Get the fixed time step of each update
+    /// \return the time step in milliseconds
+    float getUpdateStep() const {return updateStep_;}
+
+    /// Run every update step that is owed in the next frame, rather than dropping those beyond the maximum
+    ///
+    /// Used after the game loop has chosen to wait for input, since that time was not lost to a slow frame and the state's animations should keep time through it
+    void allowFullCatchUp() {isFullCatchUp_ = true;}
+
+    /// Get how far the game's clock is between the last update and the next one
+    /// \return the fraction of an update step that has not been simulated yet, between 0 and 1
+    float getAlpha() const;
+
+    /// Wait until the next frame should start (only when limiting to a target frame rate)
+    void waitForNextFrame();
+
+    /// Get the number of update steps that have been dropped because the game fell too far behind
+    /// \return the total number of dropped steps
+    long long getDroppedSteps() const {return droppedSteps_;}
+
+private:
+    typedef chrono::steady_clock clock;
+
+    long long updateStep_us_;
+    float updateStep_;
+    int maxCatchUpSteps_;
+    RenderPacing pacing_ = RenderPacing::VSYNC;
+    long long framePeriod_us_ = 0;
+
+    clock::time_point previousTime_;
+    clock::time_point frameStart_;
+    bool isStarted_ = false;
+    long long lag_us_ = 0;
+    int stepsThisFrame_ = 0;
+    bool isFullCatchUp_ = false;
+    long long droppedSteps_ = 0;
+};
+
+#endif
@@ -19,7 +19,11 @@ GameLoop::GameLoop(float width, float height, const string& title, sf::Uint32 st
     game_->window.create(sf::VideoMode(width, height), title, style);
     game_->window.setIcon( icon.width,  icon.height, icon.pixel_data );
     //game_->window.setView(game_->view);
-    game_->window.setVerticalSyncEnabled(true);
+    scheduler_.setPacing(RENDER_PACING);
+    game_->window.setVerticalSyncEnabled(RENDER_PACING == RenderPacing::VSYNC);
+    game_->profiler.setEnabled(true);
+    if (USE_RENDER_THREAD)
+        game_->renderThread.start(game_->window);
 
     // The first state is always the splash screen
     game_->stateMachine.addState(make_unique<SplashState>(game_));
@@ -27,29 +31,81 @@ GameLoop::GameLoop(float width, float height, const string& title, sf::Uint32 st
 
 void GameLoop::run()
 {
-    srand(time(NULL));
-
-    previousTime_ = clock_.getElapsedTime().asMilliseconds();
-
     while(game_->window.isOpen())
     {
         // Determine how far behind the game's clock is
-        currentTime_ = clock_.getElapsedTime().asMilliseconds();
-        elapsedTime_ = currentTime_ - previousTime_;
-        previousTime_ = currentTime_;
-        lag_ += elapsedTime_;
+        scheduler_.beginFrame();
 
-        game_->stateMachine.handleStateChange();
+        auto& profiler = game_->profiler;
+        profiler.beginFrame();
+
+        {
+            auto zone = Profiler::Zone{profiler, "handleStateChange"};
+            // New states load their assets on this thread
+            if (game_->stateMachine.isChangePending())
+                game_->renderThread.pause();
+            game_->stateMachine.handleStateChange();
+        }
 
-        game_->stateMachine.getCurrentState()->processInput();
+        {
+            auto zone = Profiler::Zone{profiler, "processInput"};
+            game_->stateMachine.getCurrentState()->processInput();
+        }
 
-        // Catch up to current frame (CHANGE: ADD MAX ITERATIONS AS A FAIL SAFE)
-        while (lag_ >= MS_PER_FRAME)
+        // Catch up to current frame, dropping any updates beyond the maximum
+        while (scheduler_.shouldUpdate())
         {
-            game_->stateMachine.getCurrentState()->update(MS_PER_FRAME);
-            lag_ -= MS_PER_FRAME;
+            auto zone = Profiler::Zone{profiler, "update"};
+            game_->stateMachine.getCurrentState()->update(scheduler_.getUpdateStep());
         }
 
-        game_->stateMachine.getCurrentState()->draw(lag_/MS_PER_FRAME);
+        {
+            auto zone = Profiler::Zone{profiler, "draw"};
+            draw(scheduler_.getAlpha());
+        }
+
+        scheduler_.waitForNextFrame();
+
+        waitIfIdle();
+
+        profiler.endFrame();
     }
+
+    game_->renderThread.stop();
+}
+
+/*------------- Private helper functions -------------*/
+
+void GameLoop::draw(float alpha)
+{
+    auto& state = game_->stateMachine.getCurrentState();
+    auto& renderThread = game_->renderThread;
+
+    if (renderThread.isRunning() && game_->window.isOpen())
+    {
+        auto& snapshot = renderThread.getBackBuffer();
+        if (state->snapshot(snapshot, alpha))
+        {
+            renderThread.resume();
+            renderThread.publish();
+            return;
+        }
+        renderThread.pause();
+    }
+
+    state->draw(alpha);
+}
+
+void GameLoop::waitIfIdle()
+{
+    auto& state = game_->stateMachine.getCurrentState();
+    auto timeout = state->getIdleTimeout();
+
+    if (timeout <= 0.f || game_->stateMachine.isChangePending() || !game_->window.isOpen())
+        return;
+
+    auto zone = Profiler::Zone{game_->profiler, "idle"};
+    game_->inputManager.waitEvent(game_->window, sf::milliseconds(static_cast<sf::Int32>(timeout)));
+
+    scheduler_.allowFullCatchUp();
 }
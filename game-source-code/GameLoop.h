@@ -6,27 +6,59 @@
 
 #include <SFML/Graphics.hpp>
 
+#include "Configuration.h"
 #include "StateMachine.h"
 #include "AssetManager.h"
 #include "InputManager.h"
+#include "Profiler.h"
+#include "FrameScheduler.h"
+#include "RenderThread.h"
+#include "MazePreviewCache.h"
 
 #include <memory>
+#include <random>
+#include <string>
+#include <vector>
 
 using namespace std;
 
 /// \class GameLoop
 /// \brief This class implements the overarching structure for the entire program
 ///
-/// Each loop of the game consists of four major steps: handling state changes, handling user input for the current state, updating the private members of the current state, and displaying them onto the screen. The elapsed time between loops is also monitored to ensure that the game objects are updated according to the real time elapsed and not the clock speed of the machine running the game
+/// Each loop of the game consists of four major steps: handling state changes, handling user input for the current state, updating the private members of the current state, and displaying them onto the screen. Each step is recorded as a zone of the frame by the game's profiler. The elapsed time between loops is also monitored by a FrameScheduler to ensure that the game objects are updated in fixed steps according to the real time elapsed and not the clock speed of the machine running the game
+///
+/// States that only change in response to input (see State::getIdleTimeout) are not drawn continuously: after each frame the loop sleeps until an event arrives or the state's timeout passes, so an idle menu uses almost no CPU or GPU
+///
+/// If USE_RENDER_THREAD is set, states that can provide a snapshot of what they draw are drawn on a RenderThread, while the next frame is being updated. Other states, and every state change, pause the render thread and run on the game thread as normal
 
 /// \struct A structure containing the core elements of the game. Namely: The state machine, asset manager, input manager and the game window
+///
+/// It also holds the little state that must outlive individual states (the score carried between levels, the shuffled playlist and the rendered maze previews), so that several games can run side by side without sharing anything. A headless game never opens its window and loads no textures, fonts or audio, so that the game logic can be run without a display or audio device (see Simulation)
+///
+/// States must close the window with closeWindow() rather than directly, as the window may be in use by the render thread
 struct Game
 {
+    /// Close the window, once the render thread (if any) has stopped drawing to it
+    void closeWindow()
+    {
+        renderThread.pause();
+        window.close();
+    }
+
     StateMachine stateMachine;
     AssetManager assetManager;
     InputManager inputManager;
     sf::RenderWindow window;
     sf::View view;
+    bool isHeadless = false;
+    Profiler profiler{PROFILER_NUM_FRAMES};
+    bool isProfilerVisible = false;
+    RenderThread renderThread;
+    MazePreviewCache mazePreviews;          // kept between visits to the maze select screen
+
+    int endScore = 0;                       // score at the end of the previous level
+    vector<Song> playlist = PLAYLIST;
+    default_random_engine randomEngine;     // used to shuffle the playlist and to seed each level
 };
 
 typedef shared_ptr<Game> gamePtr; /**\typedef a shared pointer to the Game structure, to improve readability */
@@ -48,13 +80,12 @@ public:
     void run();
 
 private:
-    sf::Clock clock_;
     gamePtr game_ = make_shared<Game>();
-    
-    float previousTime_ = 0.0f;
-    float currentTime_ = 0.0f;
-    float elapsedTime_ = 0.0f;
-    float lag_ = 0.0f;
+    FrameScheduler scheduler_;
+
+    // Private helper functions
+    void draw(float alpha);
+    void waitIfIdle();
 };
 
 #endif
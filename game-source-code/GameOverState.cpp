@@ -22,6 +22,7 @@ void GameOverState::initialise()
     loadScoreBoard(game_->assetManager);
     loadScoreText(game_->assetManager);
     loadSprites(game_->assetManager);
+    loadLayer();
 
     soundBoard_ = Soundboard{game_, enterName_};
 }
@@ -30,10 +31,10 @@ void GameOverState::processInput()
 {
     sf::Event event;
 
-    while (game_->window.pollEvent(event))
+    while (game_->inputManager.pollEvent(game_->window, event))
     {
         if (game_->inputManager.isExitRequest(event))
-            game_->window.close();
+            game_->closeWindow();
         
         if (event.type == sf::Event::Resized)
             game_->view = game_->inputManager.getLetterboxView(game_->view, event.size.width, event.size.height);
@@ -60,7 +61,7 @@ void GameOverState::processInput()
             if (restartButton_.isHover(game_->window))
             {
                 updateScores(game_->assetManager);
-                game_->assetManager.playSound("button click");
+                game_->assetManager.playSound(Sound::BUTTON_CLICK);
                 game_->stateMachine.addState(make_unique<IntermediateState>(game_, mazeName_, 1));
                 soundBoard_.restart();
             }
@@ -68,7 +69,7 @@ void GameOverState::processInput()
             if (mainMenuButton_.isHover(game_->window))
             {
                 soundBoard_.gotoMenu();
-                game_->assetManager.playSound("button click");
+                game_->assetManager.playSound(Sound::BUTTON_CLICK);
                 updateScores(game_->assetManager);
                 game_->stateMachine.addState(make_unique<MainMenuState>(game_));
             }
@@ -76,7 +77,7 @@ void GameOverState::processInput()
             if (highScoresButton_.isHover(game_->window))
             {
                 updateScores(game_->assetManager);
-                game_->assetManager.playSound("button click");
+                game_->assetManager.playSound(Sound::BUTTON_CLICK);
                 game_->stateMachine.addState(make_unique<HighScoreState>(game_));
             }
 
@@ -109,11 +110,7 @@ void GameOverState::draw(float dt)
     game_->window.clear(sf::Color{0,23,45});
     game_->window.setView(game_->view);
     
-    game_->window.draw(restartButton_);
-    game_->window.draw(mainMenuButton_);
-    game_->window.draw(highScoresButton_);
-    game_->window.draw(text_);
-    game_->window.draw(scoreText_);
+    game_->window.draw(layer_);
     
     if (enterName_)
     {
@@ -125,7 +122,6 @@ void GameOverState::draw(float dt)
     }
     else
     {
-        game_->window.draw(grass_);
         game_->window.draw(coffinDancers_);
     }
     
@@ -133,6 +129,12 @@ void GameOverState::draw(float dt)
 
 }
 
+float GameOverState::getIdleTimeout() const
+{
+    // Only woken for the next frame of whichever animation is showing
+    return enterName_ ? tStep1_/frameCount1_ : tStep_/frameCount_;
+}
+
 /*------------- Private helper functions -------------*/
 
 void GameOverState::loadButtons(AssetManager& assetManager)
@@ -175,7 +177,7 @@ void GameOverState::loadText(AssetManager& assetManager)
 void GameOverState::loadScoreText(AssetManager& assetManager)
 {
     scoreText_.setFont(*assetManager.getFont("coarse 8-bit"));
-    scoreText_.setString("Your Score: " + to_string(Scoreboard::getEndScore()));
+    scoreText_.setString("Your Score: " + to_string(game_->endScore));
     scoreText_.setOrigin(scoreText_.getGlobalBounds().width/2.f,
                          scoreText_.getGlobalBounds().height/2.f);
     scoreText_.setPosition(GAME_WIDTH/2, text_.getPosition().y + 100.f);
@@ -204,9 +206,9 @@ void GameOverState::loadScoreBoard(AssetManager& assetManager)
 
     auto highscores = assetManager.getHighScores();
 
-    scoreBoard_ = Scoreboard{highscores};
+    scoreBoard_ = Scoreboard{highscores, game_->endScore};
 
-    if (Scoreboard::getEndScore() > scoreBoard_.getFifthScore())
+    if (scoreBoard_.getCurrentScore() > scoreBoard_.getFifthScore())
     {
         enterName_ = true;
     } else
@@ -241,6 +243,19 @@ void GameOverState::loadSprites(AssetManager& assetManager)
     grass_.setTextureRect(sf::IntRect(0.f, 720.f, GAME_WIDTH, GAME_HEIGHT - 720.f));
 }
 
+void GameOverState::loadLayer()
+{
+    layer_.add(restartButton_);
+    layer_.add(mainMenuButton_);
+    layer_.add(highScoresButton_);
+    layer_.add(text_);
+    layer_.add(scoreText_);
+
+    // The grass is only shown beneath the coffin dancers
+    if (!enterName_)
+        layer_.add(grass_);
+}
+
 bool GameOverState::isValid(uint32_t unicode)
 {
     if (unicode < 65)
@@ -258,6 +273,7 @@ bool GameOverState::isValid(uint32_t unicode)
 void GameOverState::updateScores(AssetManager& assetManager)
 {
     scoreBoard_.updateHighScores(nameEntered_);
+    game_->endScore = 0;
 
     if (enterName_)
     {
@@ -7,6 +7,7 @@
 #include "State.h"
 #include "GameLoop.h"
 #include "Button.h"
+#include "RenderLayer.h"
 #include "Scoreboard.h"
 #include "Soundboard.h"
 
@@ -19,6 +20,7 @@ public:
     void processInput() override;
     void update(float dt) override;
     void draw(float dt) override;
+    float getIdleTimeout() const override;
 
 private:
     gamePtr game_;
@@ -48,6 +50,8 @@ private:
     sf::Texture bgTexture_;
     sf::Sprite grass_;
 
+    RenderLayer layer_{SCREEN_AREA, sf::Color{0,23,45}};     // everything that is not animated
+
     std::string nameEntered_ = "";
     sf::Text nameDisplay_;
     bool enterName_ = false;
@@ -62,6 +66,7 @@ private:
     void loadScoreText(AssetManager& assetManager);
     void loadScoreBoard(AssetManager& assetManager);
     void loadSprites(AssetManager& assetManager);
+    void loadLayer();
     
     void updateScores(AssetManager& assetManager);
     void updateNameEntered();
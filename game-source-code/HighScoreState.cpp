@@ -20,10 +20,10 @@ void HighScoreState::processInput()
 {
     sf::Event event;
 
-    while (game_->window.pollEvent(event))
+    while (game_->inputManager.pollEvent(game_->window, event))
     {
         if (game_->inputManager.isExitRequest(event))
-            game_->window.close();
+            game_->closeWindow();
 
         if (event.type == sf::Event::Resized)
             game_->view = game_->inputManager.getLetterboxView(game_->view, event.size.width, event.size.height);
@@ -34,7 +34,7 @@ void HighScoreState::processInput()
             {
                 checkMusic();
                 game_->stateMachine.addState(make_unique<MainMenuState>(game_));
-                game_->assetManager.playSound("button click");
+                game_->assetManager.playSound(Sound::BUTTON_CLICK);
             }
 
             if (rightButton_.isHover(game_->window))
@@ -49,12 +49,16 @@ void HighScoreState::processInput()
 void HighScoreState::update(float dt)
 {
     timeFlash += dt;
-    auto tFlash = 1200;
     auto colors = vector<sf::Color>{Gold,sf::Color::White, Silver,sf::Color::White, Bronze, sf::Color::White};
-    auto col = static_cast<int>((timeFlash/tFlash) * 6) % 6;
+    auto col = static_cast<int>((timeFlash/tFlash_) * 6) % 6;
 
-    title_.setFillColor(colors[col]);
-    background.setColor(colors[col]);
+    if (col != flashColour_)
+    {
+        title_.setFillColor(colors[col]);
+        background.setColor(colors[col]);
+        flashColour_ = col;
+        layer_.invalidate();
+    }
 
     exitButton_.update(game_->window);
 
@@ -79,23 +83,17 @@ void HighScoreState::draw(float dt)
     game_->window.clear();
     game_->window.setView(game_->view);
 
-    game_->window.draw(background);
-    game_->window.draw(exitButton_);
-    game_->window.draw(rightButton_);
-    game_->window.draw(leftButton_);
-
-    game_->window.draw(title_);
-
-    game_->window.draw(mazeDisplay_);
-
-    for (auto item : entries)
-    {
-        game_->window.draw(item);
-    }
+    game_->window.draw(layer_);
 
     game_->window.display();
 }
 
+float HighScoreState::getIdleTimeout() const
+{
+    // Only woken for the next colour of the flashing title
+    return tFlash_/6;
+}
+
 /*------------- Private helper functions -------------*/
 
 void HighScoreState::loadButtons(AssetManager& assetManager)
@@ -141,10 +139,10 @@ void HighScoreState::nextMaze()
     if (mazeIt+1 != mazeNames_.end())
     {
         mazeIt++;
-        game_->assetManager.playSound("button click");
+        game_->assetManager.playSound(Sound::BUTTON_CLICK);
     } else
     {
-        game_->assetManager.playSound("error");
+        game_->assetManager.playSound(Sound::BUTTON_ERROR);
         return;
     }
 
@@ -156,10 +154,10 @@ void HighScoreState::previousMaze()
     if (mazeIt != mazeNames_.begin())
     {
         mazeIt--;
-        game_->assetManager.playSound("button click");
+        game_->assetManager.playSound(Sound::BUTTON_CLICK);
     } else
     {
-        game_->assetManager.playSound("error");
+        game_->assetManager.playSound(Sound::BUTTON_ERROR);
         return;
     }
 
@@ -168,14 +166,14 @@ void HighScoreState::previousMaze()
 
 void HighScoreState::checkMusic()
 {
-    if (game_->assetManager.getStatus("xue hua piao") == sf::SoundSource::Status::Playing)
+    if (game_->assetManager.getStatus(Song::XUE_HUA_PIAO) == sf::SoundSource::Status::Playing)
     {
-        game_->assetManager.stopSong("xue hua piao");
+        game_->assetManager.stopSong(Song::XUE_HUA_PIAO);
     }
 
-    if (game_->assetManager.getStatus("coffin dance") == sf::SoundSource::Status::Playing)
+    if (game_->assetManager.getStatus(Song::COFFIN_DANCE) == sf::SoundSource::Status::Playing)
     {
-        game_->assetManager.stopSong("coffin dance");
+        game_->assetManager.stopSong(Song::COFFIN_DANCE);
     }
 }
 
@@ -212,4 +210,24 @@ void HighScoreState::loadHighScores(AssetManager& assetManager)
     entries[0].setFillColor(Gold);
     entries[1].setFillColor(Silver);
     entries[2].setFillColor(Bronze);
+
+    loadLayer();
+}
+
+void HighScoreState::loadLayer()
+{
+    // The layer holds the current maze's entries, so it is refilled whenever the maze changes
+    layer_.clear();
+
+    layer_.add(background);
+    layer_.add(exitButton_);
+    layer_.add(rightButton_);
+    layer_.add(leftButton_);
+
+    layer_.add(title_);
+
+    layer_.add(mazeDisplay_);
+
+    for (const auto& item : entries)
+        layer_.add(item);
 }
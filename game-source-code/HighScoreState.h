@@ -6,6 +6,7 @@
 #include "State.h"
 #include "GameLoop.h"
 #include "Button.h"
+#include "RenderLayer.h"
 
 class HighScoreState: public State
 {
@@ -19,6 +20,7 @@ public:
     void processInput() override;
     void update(float dt) override;
     void draw(float dt) override;
+    float getIdleTimeout() const override;
 
 private:
     gamePtr game_;
@@ -34,16 +36,22 @@ private:
     sf::Sprite background;
 
     float timeFlash = 0;
+    float tFlash_ = 1200;       // time taken to flash through all six colours (milliseconds)
+    int flashColour_ = -1;      // index of the colour the title and background are flashing
 
 
     sf::Text mazeDisplay_;
     vector<sf::Text> entries;
     sf::Text title_;
+
+    RenderLayer layer_{SCREEN_AREA};
+
     // Private helper functions
     void loadButtons(AssetManager& assetManager);
     void loadMazes(AssetManager& assetManager);
     void loadHighScores(AssetManager& assetManager);
     void loadTitle(AssetManager& assetManager);
+    void loadLayer();
     void previousMaze();
     void nextMaze();
     void checkMusic();
@@ -2,25 +2,14 @@
 #include <cmath>
 #include <iostream>
 
-#include "EnemyScatterState.h"
-
-Inky::Inky(map<string,texturePtr> textures, sf::Vector2f position, playerPtr player, mazePtr maze, enemyPtr blinky) :
-    Enemy(textures, position, player, maze), blinky_{blinky}
+Inky::Inky(Clips clips, sf::Vector2f position, playerPtr player, mazePtr maze, enemyPtr blinky) :
+    Enemy(clips, position, player, maze), blinky_{blinky}
 {
     current_dir_ = UP;
     default_dir_ = UP;
 }
 
 
-void Inky::update(float dt)
-{
-    if (char_states_.empty())
-        addCharState(std::make_shared<EnemyScatterState>(this, maze_));
-
-    updateCharState();
-    char_states_.top()->update(dt);
-}
-
 sf::Vector2f Inky::getChaseTarget()
 {
     auto target = player_->getCurrentTile() + float{2*maze_->getTileLength()}*player_->currentDir();
@@ -33,26 +33,14 @@ class Inky : public Enemy
          *
          *  Constructs an Enemy object and initialises the default direction to UP
          *
-         *  \param textures, a map<string,texturePtr> which maps a label to a texture pointer
+         *  \param clips, the animation clips of the enemy (which can be given as a map of textures)
          *  \param position, an sf::Vector2f which contains the x and y coordinates of the
          *      default and initial position of Inky
          *  \param player, a pointer to the Player
          *  \param maze, a pointer to the Maze
          *  \param blinky, a pointer to Blinky
          */
-        Inky(map<string,texturePtr> textures, sf::Vector2f position, playerPtr player, mazePtr maze, enemyPtr blinky);
-
-        /** \brief Handles Inky's state changes, as well as calls on the current state to update
-         *
-         *  First any state changes are handled and updated using inherited functionality.
-         *  After this, the currrent state's update function is called, passing in the time
-         *  increment dt.
-         *
-         *  If the state stack is empty, a Scatter State is added to it
-         *
-         *  \param dt, the time increment since the last call to update
-         */
-        void update(float dt) override;
+        Inky(Clips clips, sf::Vector2f position, playerPtr player, mazePtr maze, enemyPtr blinky);
 
         /** \brief Returns the chase target for Inky
          *
@@ -75,6 +63,9 @@ class Inky : public Enemy
          */
         sf::Vector2f getScatterTarget() override;
 
+        /** \brief Returns "Inky" */
+        const char* getName() const override {return "Inky";}
+
     protected:
 
     private:
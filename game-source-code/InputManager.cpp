@@ -1,5 +1,7 @@
 #include "InputManager.h"
 
+#include "Configuration.h"
+
 bool InputManager::isObjectClicked(sf::Sprite object, sf::Mouse::Button mouseButton, const sf::RenderWindow& window) const
 {
     if(!sf::Mouse::isButtonPressed(mouseButton))
@@ -67,3 +69,41 @@ sf::View InputManager::getLetterboxView(sf::View view, int windowWidth, int wind
 
     return view;
 }
+
+void InputManager::pushEvent(const sf::Event& event)
+{
+    queuedEvents_.push(event);
+}
+
+bool InputManager::pollEvent(sf::RenderWindow& window, sf::Event& event)
+{
+    if (queuedEvents_.empty())
+        return window.pollEvent(event);
+
+    event = queuedEvents_.front();
+    queuedEvents_.pop();
+    return true;
+}
+
+bool InputManager::waitEvent(sf::RenderWindow& window, sf::Time timeout)
+{
+    if (!queuedEvents_.empty())
+        return true;
+
+    // SFML's own waitEvent() cannot time out, and it also polls and sleeps internally, so the same is done here
+    auto clock = sf::Clock{};
+    auto event = sf::Event{};
+
+    while (clock.getElapsedTime() < timeout)
+    {
+        if (window.pollEvent(event))
+        {
+            queuedEvents_.push(event);
+            return true;
+        }
+
+        sf::sleep(sf::milliseconds(IDLE_POLL_INTERVAL));
+    }
+
+    return false;
+}
@@ -3,6 +3,8 @@
 
 #include <SFML/Graphics.hpp>
 
+#include <queue>
+
 using namespace std;
 
 class InputManager
@@ -23,8 +25,28 @@ public:
     
     // Implement input functions that would be useful for handling input independent of state below
 
+    /// Queue an event to be handed out by pollEvent() before any events from the window
+    ///
+    /// This allows input to be scripted when there is no window (e.g. a headless game)
+    /// @param event the event to queue
+    void pushEvent(const sf::Event& event);
+    
+    /// Pop the next scripted event, or poll the window if there are none
+    /// @param window the window to poll
+    /// @param event the event to fill in
+    /// \return true if an event was returned, and false otherwise
+    bool pollEvent(sf::RenderWindow& window, sf::Event& event);
+
+    /// Wait until there is an event for pollEvent() to return, or until the timeout passes
+    ///
+    /// An event taken from the window is queued, so that it is still handed out by pollEvent()
+    /// @param window the window to wait on
+    /// @param timeout the longest time to wait
+    /// \return true if there is an event, and false if the timeout passed first
+    bool waitEvent(sf::RenderWindow& window, sf::Time timeout);
     
 private:
+    queue<sf::Event> queuedEvents_;
 
 };
 
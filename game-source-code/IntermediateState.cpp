@@ -4,6 +4,8 @@
 
 #include "Configuration.h"
 
+#include <algorithm>
+
 IntermediateState::IntermediateState(gamePtr game, string mazeName, int lvlNumber): game_{game}, mazeName_{mazeName}, lvlNumber_{lvlNumber}
 {
     // error checking
@@ -18,10 +20,10 @@ void IntermediateState::processInput()
 {
     sf::Event event;
 
-    while (game_->window.pollEvent(event))
+    while (game_->inputManager.pollEvent(game_->window, event))
     {
         if (game_->inputManager.isExitRequest(event))
-            game_->window.close();
+            game_->closeWindow();
         
         if (event.type == sf::Event::Resized)
             game_->view = game_->inputManager.getLetterboxView(game_->view, event.size.width, event.size.height);
@@ -31,7 +33,8 @@ void IntermediateState::processInput()
 void IntermediateState::update(float dt)
 {
     elapsedTime += dt;
-    if (elapsedTime > INTER_DISPLAY_TIME*1000)
+    // After an idle wait several updates run at once, but the level only needs to be started by the first
+    if (elapsedTime > INTER_DISPLAY_TIME*1000 && !game_->stateMachine.isChangePending())
     {
         game_->stateMachine.addState(make_unique<EndlessLevelState>(game_,mazeName_,lvlNumber_));
     }
@@ -48,6 +51,12 @@ void IntermediateState::draw(float dt)
     game_->window.display();
 }
 
+float IntermediateState::getIdleTimeout() const
+{
+    // Nothing changes until it is time to start the level
+    return max(INTER_DISPLAY_TIME*1000 - elapsedTime, 0.0);
+}
+
 /*------------- Private helper functions -------------*/
 
 void IntermediateState::loadText(AssetManager& assetManager)
@@ -16,6 +16,7 @@ public:
     void processInput() override;
     void update(float dt) override;
     void draw(float dt) override;
+    float getIdleTimeout() const override;
 
 private:
     gamePtr game_;
@@ -2,6 +2,7 @@
 #include "MainMenuState.h"
 #include "MazeEditorHelp.h"
 
+#include <algorithm>
 #include <cmath>
 #include <string>
 #include <iostream>
@@ -17,7 +18,12 @@ bool sf::operator<(const Vector2i& left, const Vector2i& right)
     return left.x < right.x || (left.x == right.x && left.y < right.y);
 }
 
-LevelEditorState::LevelEditorState(gamePtr game): game_{game}
+LevelEditorState::LevelEditorState(gamePtr game, int numRows, int numCols):
+    game_{game},
+    numRows_{clamp(numRows, MIN_GRID_TILES, MAX_GRID_TILES)},
+    numCols_{clamp(numCols, MIN_GRID_TILES, MAX_GRID_TILES)},
+    layout_(numRows_, string(numCols_,'E')),
+    rotationMap_(numRows_, string(numCols_,'0'))
 {
     // error checking
 }
@@ -33,10 +39,10 @@ void LevelEditorState::processInput()
 {
     sf::Event event;
 
-    while (game_->window.pollEvent(event))
+    while (game_->inputManager.pollEvent(game_->window, event))
     {
         if (game_->inputManager.isExitRequest(event))
-            game_->window.close();
+            game_->closeWindow();
         
         if (event.type == sf::Event::Resized)
         {
@@ -86,6 +92,38 @@ void LevelEditorState::processInput()
 
             if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::C)
                 clear();
+
+            if (event.type == sf::Event::KeyPressed)
+            {
+                auto direction = sf::Vector2i{0,0};
+
+                switch (event.key.code)
+                {
+                    case sf::Keyboard::Left:
+                        direction = sf::Vector2i{-1,0};
+                        break;
+                    case sf::Keyboard::Right:
+                        direction = sf::Vector2i{1,0};
+                        break;
+                    case sf::Keyboard::Up:
+                        direction = sf::Vector2i{0,-1};
+                        break;
+                    case sf::Keyboard::Down:
+                        direction = sf::Vector2i{0,1};
+                        break;
+                    default:
+                        break;
+                }
+
+                if (direction != sf::Vector2i{0,0})
+                {
+                    // SHIFT adds a row or column when moving right or down, and removes one when moving left or up
+                    if (event.key.shift)
+                        resizeGrid(numRows_ + direction.y, numCols_ + direction.x);
+
+                    scrollGrid(direction);
+                }
+            }
         }
     }
 }
@@ -102,7 +140,6 @@ void LevelEditorState::draw(float dt)
     game_->window.clear(sf::Color{26,26,26});
     game_->window.setView(game_->view);
 
-    game_->window.draw(background_);
     drawGrid();
     game_->window.draw(displayName_);
     drawButtons();
@@ -198,7 +235,6 @@ void LevelEditorState::loadBuildButtons(AssetManager& assetManager)
     button.setSpriteColour(sf::Color::White, sf::Color::White, sf::Color::White);
     button.setOutlineColour(sf::Color::Transparent, sf::Color::Yellow, sf::Color::Transparent);
     button.setOutline(2.f);
-    button.setPosition(390.f, 570.f);
     buildButtons_[BuildSelection::PLAYER] = button;
 
     textureString = vector<string>
@@ -220,13 +256,14 @@ void LevelEditorState::loadBuildButtons(AssetManager& assetManager)
     for (auto i = 0; i < selection.size(); i++)
     {
         button = Button(assetManager.getTexture(textureString[i]));
-        button.setPosition(300.f + i*60, 300.f);
         button.setSpriteScale(10.f/7.f, 10.f/7.f);
         button.setSpriteColour(sf::Color::White, sf::Color::White, sf::Color::White);
         button.setOutlineColour(sf::Color::Transparent, sf::Color::Yellow, sf::Color::Transparent);
         button.setOutline(2.f);
         buildButtons_[selection[i]] = button;
     }
+
+    resetCharacters();
 }
 
 void LevelEditorState::loadGrid()
@@ -241,8 +278,8 @@ void LevelEditorState::loadGrid()
     bgTexture_ = *game_->assetManager.getTexture("grass");
     bgTexture_.setRepeated(true);
     background_.setTexture(bgTexture_);
-    background_.setPosition(GRID_POSITION.x, GRID_POSITION.y);
-    background_.setTextureRect(sf::IntRect(GRID_POSITION.x, GRID_POSITION.y, GRID_SIZE.x, GRID_SIZE.y));
+
+    updateCamera();
 }
 
 void LevelEditorState::loadGridLines()
@@ -250,21 +287,23 @@ void LevelEditorState::loadGridLines()
     auto pos1 = sf::Vector2f{0,0};
     auto pos2 = sf::Vector2f{0,0};
 
+    gridLines_.clear();
+
     // Horizontal lines
-    for (auto row = 0; row < NUM_ROWS + 1; row++)
+    for (auto row = 0; row < numRows_ + 1; row++)
     {
         pos1 = sf::Vector2f{GRID_POSITION.x, GRID_POSITION.y + row * GRID_SPACING};
-        pos2 = sf::Vector2f{GRID_POSITION.x + (NUM_COLS) * GRID_SPACING, GRID_POSITION.y + row * GRID_SPACING};
+        pos2 = sf::Vector2f{GRID_POSITION.x + numCols_ * GRID_SPACING, GRID_POSITION.y + row * GRID_SPACING};
 
         gridLines_.push_back(sf::Vertex(pos1, sf::Color::Black));
         gridLines_.push_back(sf::Vertex(pos2, sf::Color::Black));
     }
 
     // Vertical lines
-    for (auto col = 0; col < NUM_COLS + 1; col++)
+    for (auto col = 0; col < numCols_ + 1; col++)
     {
         pos1 = sf::Vector2f{GRID_POSITION.x + col * GRID_SPACING, GRID_POSITION.y};
-        pos2 = sf::Vector2f{GRID_POSITION.x + col * GRID_SPACING, GRID_POSITION.y + (NUM_ROWS) * GRID_SPACING};
+        pos2 = sf::Vector2f{GRID_POSITION.x + col * GRID_SPACING, GRID_POSITION.y + numRows_ * GRID_SPACING};
 
         gridLines_.push_back(sf::Vertex(pos1, sf::Color::Black));
         gridLines_.push_back(sf::Vertex(pos2, sf::Color::Black));
@@ -276,30 +315,9 @@ void LevelEditorState::loadGridNumbers()
     sf::Text num;
     num.setFont(*game_->assetManager.getFont("pressStart 8-bit"));
 
-    gridNumbers_.push_back(num);
-
-    for (int i = 0; i < 25; i++)
-    {
-        num.setString(to_string(i));
-        num.setOrigin(num.getLocalBounds().width/2, num.getLocalBounds().height/2);
-        num.setPosition(GRID_POSITION.x/2.f, GRID_POSITION.y + i * GRID_SPACING + GRID_SPACING/2.f);
-        num.setScale(0.45, 0.45);
-        gridNumbers_.push_back(num);
-    }
-
-    for (int i = 0; i < 23; i++)
-    {
-        num.setString(to_string(i));
-        num.setOrigin(num.getLocalBounds().width/2, num.getLocalBounds().height/2);
-        num.setPosition(GRID_POSITION.x + i * GRID_SPACING + GRID_SPACING/2.f, GRID_POSITION.y + GRID_SIZE.y + 15);
-
-        if (i < 10)
-            num.setScale(0.45, 0.45);
-        else
-            num.setScale(0.39, 0.39);
-
-        gridNumbers_.push_back(num);
-    }
+    // One number beside each row and column of the part of the screen showing the grid (see updateGridNumbers)
+    rowNumbers_.assign(NUM_ROWS, num);
+    colNumbers_.assign(NUM_COLS, num);
 }
 
 void LevelEditorState::loadHighlightSquare()
@@ -329,13 +347,27 @@ void LevelEditorState::loadTextBox()
 
 }
 
+void LevelEditorState::resetCharacters()
+{
+    // The characters start in the middle of the grid: the enemies side by side, with the player below them
+    auto centre = sf::Vector2i{numCols_/2, numRows_/2};
+    auto enemyRow = max(centre.y - 4, 0);
+    auto playerRow = min(centre.y + 5, numRows_ - 1);
+
+    buildButtons_[BuildSelection::PLAYER].setPosition(map2GridPosition(sf::Vector2i{centre.x, playerRow}));
+    buildButtons_[BuildSelection::BLINKY].setPosition(map2GridPosition(sf::Vector2i{centre.x - 3, enemyRow}));
+    buildButtons_[BuildSelection::PINKY].setPosition(map2GridPosition(sf::Vector2i{centre.x - 1, enemyRow}));
+    buildButtons_[BuildSelection::INKY].setPosition(map2GridPosition(sf::Vector2i{centre.x + 1, enemyRow}));
+    buildButtons_[BuildSelection::CLYDE].setPosition(map2GridPosition(sf::Vector2i{centre.x + 3, enemyRow}));
+}
+
 /*----- Handling input -----*/
 
 void LevelEditorState::handleButtonInput()
 {
     if (bottomButtons_[BottomSelection::EXIT].isHover(game_->window))
     {
-        game_->assetManager.playSound("button click");
+        game_->assetManager.playSound(Sound::BUTTON_CLICK);
         game_->stateMachine.addState(make_unique<MainMenuState>(game_));
     }
 
@@ -347,13 +379,13 @@ void LevelEditorState::handleButtonInput()
 
     if (bottomButtons_[BottomSelection::CLEAR].isHover(game_->window))
     {
-        game_->assetManager.playSound("button click");
+        game_->assetManager.playSound(Sound::BUTTON_CLICK);
         clear();
     }
 
     if (bottomButtons_[BottomSelection::HELP].isHover(game_->window))
     {
-        game_->assetManager.playSound("button click");
+        game_->assetManager.playSound(Sound::BUTTON_CLICK);
         game_->stateMachine.addState(make_unique<MazeEditorHelp>(game_));
     }
 
@@ -364,18 +396,18 @@ bool LevelEditorState::saveSuccessful()
 {
     if (mazeName_.size() == 0)
     {
-        game_->assetManager.playSound("error");
+        game_->assetManager.playSound(Sound::BUTTON_ERROR);
         displayName_.setFillColor(sf::Color::Red);
         return false;
     }
 
     if (mazeHasNoEdibles())
     {
-        game_->assetManager.playSound("error");
+        game_->assetManager.playSound(Sound::BUTTON_ERROR);
         return false;
     }
 
-    game_->assetManager.playSound("button click");
+    game_->assetManager.playSound(Sound::BUTTON_CLICK);
 
     auto& assetMan = game_->assetManager;
 
@@ -416,18 +448,14 @@ bool LevelEditorState::mazeHasNoEdibles()
 
 void LevelEditorState::clear()
 {
-    gridSprites_.clear();
+    gridChunks_.clear();
     keyMapPos_.clear();
     keyMapIndices_.clear();
     currentSelection_ = BuildSelection::NOTHING;
 
     isKeySelected_ = false;
 
-    buildButtons_[BuildSelection::PLAYER].setPosition(390.f, 570.f);
-    buildButtons_[BuildSelection::BLINKY].setPosition(300.f, 300.f);
-    buildButtons_[BuildSelection::PINKY].setPosition(360.f, 300.f);
-    buildButtons_[BuildSelection::INKY].setPosition(420.f, 300.f);
-    buildButtons_[BuildSelection::CLYDE].setPosition(480.f, 300.f);
+    resetCharacters();
 
     for (auto& [selection, button] : buildButtons_)
     {
@@ -435,8 +463,8 @@ void LevelEditorState::clear()
         button.setRotation(0.f);
     }
 
-    layout_ = vector<string>{NUM_ROWS, string(NUM_COLS,'E')};
-    rotationMap_ = vector<string>{NUM_ROWS, string(NUM_COLS,'0')};
+    layout_ = vector<string>(numRows_, string(numCols_,'E'));
+    rotationMap_ = vector<string>(numRows_, string(numCols_,'0'));
 
     mazeName_ = "";
 }
@@ -445,7 +473,7 @@ void LevelEditorState::selectBuildButton()
 {
     for (auto [selection, button] : buildButtons_)
     {
-        if (button.isHover(game_->window))
+        if (isHover(selection, button))
         {
             if (selection == previousSelection_)
             {
@@ -454,7 +482,7 @@ void LevelEditorState::selectBuildButton()
             }
             else
             {
-                game_->assetManager.playSound("select button");
+                game_->assetManager.playSound(Sound::SELECT_BUTTON);
                 currentSelection_ = selection;
             }
         }
@@ -536,7 +564,7 @@ void LevelEditorState::handleKeyLinkEvent()
 
 bool LevelEditorState::isKeyBlock()
 {
-    auto pos = map2GridPosition(game_->window.mapPixelToCoords(sf::Mouse::getPosition(game_->window)));
+    auto pos = map2GridPosition(getMouseGridPosition());
     auto index = map2GridIndex(pos);
     auto layoutChar = layout_[index.y].at(index.x);
 
@@ -548,7 +576,7 @@ bool LevelEditorState::isKeyBlock()
 
 bool LevelEditorState::isGateBlock()
 {
-    auto pos = map2GridPosition(game_->window.mapPixelToCoords(sf::Mouse::getPosition(game_->window)));
+    auto pos = map2GridPosition(getMouseGridPosition());
     auto index = map2GridIndex(pos);
     auto layoutChar = layout_[index.y].at(index.x);
 
@@ -560,20 +588,20 @@ bool LevelEditorState::isGateBlock()
 
 void LevelEditorState::selectKey()
 {
-    game_->assetManager.playSound("key");
+    game_->assetManager.playSound(Sound::KEY);
     isKeySelected_ = true;
     currentSelection_ = BuildSelection::NOTHING;
     applyRadioStyle();
 
-    auto pos = map2GridPosition(game_->window.mapPixelToCoords(sf::Mouse::getPosition(game_->window)));
+    auto pos = map2GridPosition(getMouseGridPosition());
     selectedKeyPos_ = pos;
     selectedKeyIndex_ = map2GridIndex(pos);
 }
 
 void LevelEditorState::addGate()
 {
-    game_->assetManager.playSound("gate link");
-    auto pos = map2GridPosition(game_->window.mapPixelToCoords(sf::Mouse::getPosition(game_->window)));
+    game_->assetManager.playSound(Sound::GATE_LINK);
+    auto pos = map2GridPosition(getMouseGridPosition());
 
     keyMapPos_[selectedKeyPos_].push_back(pos);
     keyMapIndices_[selectedKeyIndex_].push_back(map2GridIndex(pos));
@@ -589,6 +617,54 @@ void LevelEditorState::rotateSelectedSprite()
     buildButtons_[currentSelection_].setRotation(angle);
 }
 
+void LevelEditorState::scrollGrid(sf::Vector2i direction)
+{
+    scroll_ += direction;
+    updateCamera();
+}
+
+void LevelEditorState::resizeGrid(int numRows, int numCols)
+{
+    numRows = clamp(numRows, MIN_GRID_TILES, MAX_GRID_TILES);
+    numCols = clamp(numCols, MIN_GRID_TILES, MAX_GRID_TILES);
+
+    if (numRows == numRows_ && numCols == numCols_)
+        return;
+
+    // Tiles beyond the new edges are erased, along with their links
+    auto removed = vector<sf::Vector2f>{};
+
+    for (const auto& [chunkIndex, chunk] : gridChunks_)
+        for (const auto& [index, sprite] : chunk)
+            if (index.x >= numCols || index.y >= numRows)
+                removed.push_back(sprite.getPosition());
+
+    for (auto position : removed)
+        removeGridSprite(position);
+
+    numRows_ = numRows;
+    numCols_ = numCols;
+
+    layout_.resize(numRows_, string(numCols_,'E'));
+    rotationMap_.resize(numRows_, string(numCols_,'0'));
+
+    for (auto row = 0; row < numRows_; row++)
+    {
+        layout_[row].resize(numCols_, 'E');
+        rotationMap_[row].resize(numCols_, '0');
+    }
+
+    // Characters beyond the new edges are moved back onto the grid
+    for (auto selection : {BuildSelection::PLAYER, BuildSelection::BLINKY, BuildSelection::PINKY, BuildSelection::INKY, BuildSelection::CLYDE})
+    {
+        auto index = map2GridIndex(buildButtons_[selection].getPosition());
+        buildButtons_[selection].setPosition(map2GridPosition(sf::Vector2i{min(index.x, numCols_ - 1), min(index.y, numRows_ - 1)}));
+    }
+
+    loadGridLines();
+    updateCamera();
+}
+
 /*----- Updating state elements -----*/
 
 void LevelEditorState::updateButtons()
@@ -597,7 +673,12 @@ void LevelEditorState::updateButtons()
         button.update(game_->window);
 
     for (auto& [selection, button] : buildButtons_)
-        button.update(game_->window);
+    {
+        if (isOnGrid(selection))
+            button.update(game_->window, getGridView());
+        else
+            button.update(game_->window);
+    }
 }
 
 void LevelEditorState::updateGrid()
@@ -607,7 +688,7 @@ void LevelEditorState::updateGrid()
     if (currentSelection_ == BuildSelection::NOTHING)
         return;
 
-    auto mousePos = map2GridPosition(game_->window.mapPixelToCoords(sf::Mouse::getPosition(game_->window)));
+    auto mousePos = map2GridPosition(getMouseGridPosition());
 
     if (isMousePressed() && gridContainsMouse())
     {
@@ -623,20 +704,126 @@ bool LevelEditorState::isMousePressed()
     return sf::Mouse::isButtonPressed(sf::Mouse::Left);
 }
 
+void LevelEditorState::updateCamera()
+{
+    auto numVisibleTiles = sf::Vector2f{GRID_SIZE.x/GRID_SPACING, GRID_SIZE.y/GRID_SPACING};
+    camera_.follow(GRID_POSITION + GRID_SPACING*(sf::Vector2f(scroll_) + numVisibleTiles/2.f), getGridArea());
+
+    // The camera stops at the edges of the grid, so the scroll is limited to match
+    auto visibleArea = camera_.getVisibleArea();
+    scroll_ = sf::Vector2i(round((visibleArea.left - GRID_POSITION.x)/GRID_SPACING),
+                           round((visibleArea.top - GRID_POSITION.y)/GRID_SPACING));
+
+    // The grass covers the part of the grid in view
+    auto gridArea = getGridArea();
+    background_.setPosition(visibleArea.left, visibleArea.top);
+    background_.setTextureRect(sf::IntRect(visibleArea.left, visibleArea.top,
+                                           min(visibleArea.width, gridArea.width), min(visibleArea.height, gridArea.height)));
+
+    updateGridNumbers();
+}
+
+void LevelEditorState::updateGridNumbers()
+{
+    // The numbers stay beside the part of the screen showing the grid, counting from the tile in the top left corner of the view
+    for (auto i = 0u; i < rowNumbers_.size(); i++)
+    {
+        auto& num = rowNumbers_[i];
+        auto row = scroll_.y + static_cast<int>(i);
+
+        num.setString(to_string(row));
+        num.setOrigin(num.getLocalBounds().width/2, num.getLocalBounds().height/2);
+        num.setPosition(GRID_POSITION.x/2.f, GRID_POSITION.y + i * GRID_SPACING + GRID_SPACING/2.f);
+
+        if (row < 100)
+            num.setScale(0.45, 0.45);
+        else
+            num.setScale(0.3, 0.3);
+    }
+
+    for (auto i = 0u; i < colNumbers_.size(); i++)
+    {
+        auto& num = colNumbers_[i];
+        auto col = scroll_.x + static_cast<int>(i);
+
+        num.setString(to_string(col));
+        num.setOrigin(num.getLocalBounds().width/2, num.getLocalBounds().height/2);
+        num.setPosition(GRID_POSITION.x + i * GRID_SPACING + GRID_SPACING/2.f, GRID_POSITION.y + GRID_SIZE.y + 15);
+
+        if (col < 10)
+            num.setScale(0.45, 0.45);
+        else if (col < 100)
+            num.setScale(0.39, 0.39);
+        else
+            num.setScale(0.27, 0.27);
+    }
+}
+
 bool LevelEditorState::gridContainsMouse()
 {
-    return gridBounds_.contains(game_->window.mapPixelToCoords(sf::Mouse::getPosition(game_->window)));
+    auto mousePos = game_->window.mapPixelToCoords(sf::Mouse::getPosition(game_->window), game_->view);
+
+    return gridBounds_.contains(mousePos) && getGridArea().contains(getMouseGridPosition());
+}
+
+bool LevelEditorState::isHover(BuildSelection selection, const Button& button)
+{
+    // The characters are placed on the grid, so they can only be hovered over within the part of the screen showing it
+    if (isOnGrid(selection))
+        return gridContainsMouse() && button.isHover(game_->window, getGridView());
+
+    return button.isHover(game_->window);
+}
+
+bool LevelEditorState::isOnGrid(BuildSelection selection)
+{
+    switch (selection)
+    {
+        case BuildSelection::PLAYER:
+        case BuildSelection::BLINKY:
+        case BuildSelection::INKY:
+        case BuildSelection::PINKY:
+        case BuildSelection::CLYDE:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+sf::Vector2f LevelEditorState::getMouseGridPosition()
+{
+    return game_->window.mapPixelToCoords(sf::Mouse::getPosition(game_->window), getGridView());
+}
+
+sf::View LevelEditorState::getGridView()
+{
+    return camera_.getView(game_->view);
+}
+
+sf::FloatRect LevelEditorState::getGridArea()
+{
+    return sf::FloatRect{GRID_POSITION, sf::Vector2f{numCols_ * GRID_SPACING, numRows_ * GRID_SPACING}};
+}
+
+sf::Vector2i LevelEditorState::getChunk(sf::Vector2i index)
+{
+    return sf::Vector2i{index.x / MAZE_CHUNK_SIZE, index.y / MAZE_CHUNK_SIZE};
 }
 
 void LevelEditorState::removeGridSprite(sf::Vector2f position)
 {
 
     auto index = map2GridIndex(position);
+    auto chunk = gridChunks_.find(getChunk(index));
 
-    if (gridSprites_.find({position.x,position.y}) != gridSprites_.end())
-
+    if (chunk != gridChunks_.end() && chunk->second.find(index) != chunk->second.end())
     {
-        gridSprites_.erase({position.x,position.y});
+        chunk->second.erase(index);
+
+        if (chunk->second.empty())
+            gridChunks_.erase(chunk);
+
         layout_[index.y].at(index.x) = 'E';
         rotationMap_[index.y].at(index.x) = '0';
         updateKeyMap(position, index);
@@ -645,9 +832,9 @@ void LevelEditorState::removeGridSprite(sf::Vector2f position)
 
 void LevelEditorState::addGridSprite(sf::Vector2f position)
 {
-    gridSprites_[{position.x,position.y}] = createGridSprite(position);
-
     auto index = map2GridIndex(position);
+    gridChunks_[getChunk(index)][index] = createGridSprite(position);
+
     layout_[index.y].at(index.x) = getLayoutChar();
     rotationMap_[index.y].at(index.x) = getAngleChar();
     updateKeyMap(position, index);
@@ -687,6 +874,11 @@ void LevelEditorState::updateKeyMap(sf::Vector2f position, sf::Vector2i index)
         keyMapIndices_.erase(pos);
 }
 
+sf::Vector2f LevelEditorState::map2GridPosition(sf::Vector2i position)
+{
+    return GRID_POSITION + GRID_SPACING*sf::Vector2f(position) + sf::Vector2f{GRID_SPACING/2.f, GRID_SPACING/2.f};
+}
+
 sf::Vector2f LevelEditorState::map2GridPosition(sf::Vector2f position)
 {
     auto yPos = GRID_POSITION.y + floor((position.y - GRID_POSITION.y)/GRID_SPACING) * GRID_SPACING + GRID_SPACING/2.f;
@@ -803,7 +995,7 @@ void LevelEditorState::updateCharacters()
         }
         else if (gridContainsMouse())
         {
-            auto mousePos = game_->window.mapPixelToCoords(sf::Mouse::getPosition(game_->window));
+            auto mousePos = getMouseGridPosition();
             buildButtons_[characters[i]].setPosition(map2GridPosition(mousePos));
         }
     }
@@ -817,27 +1009,46 @@ void LevelEditorState::drawButtons()
         game_->window.draw(button);
 
     for (auto& [selection, button] : buildButtons_)
-        game_->window.draw(button);
+        if (!isOnGrid(selection))
+            game_->window.draw(button);
+}
+
+void LevelEditorState::drawCharacters()
+{
+    for (auto& [selection, button] : buildButtons_)
+        if (isOnGrid(selection))
+            game_->window.draw(button);
 }
 
 void LevelEditorState::drawGrid()
 {
+    // Everything on the grid is drawn through the camera, which clips it to the part of the screen showing the grid
+    game_->window.setView(getGridView());
+
+    game_->window.draw(background_);
     game_->window.draw(&gridLines_[0], gridLines_.size(), sf::Lines);
-    drawGridNumbers();
     drawHighlightSquare();
     drawGridSprites();
     drawLinkLines();
+    drawCharacters();
+
+    game_->window.setView(game_->view);
+
+    drawGridNumbers();
 }
 
 void LevelEditorState::drawGridNumbers()
 {
-    for (auto num : gridNumbers_)
-        game_->window.draw(num);
+    for (auto i = 0; i < min<int>(rowNumbers_.size(), numRows_); i++)
+        game_->window.draw(rowNumbers_[i]);
+
+    for (auto i = 0; i < min<int>(colNumbers_.size(), numCols_); i++)
+        game_->window.draw(colNumbers_[i]);
 }
 
 void LevelEditorState::drawHighlightSquare()
 {
-    auto mousePos = map2GridPosition(game_->window.mapPixelToCoords(sf::Mouse::getPosition(game_->window)));
+    auto mousePos = map2GridPosition(getMouseGridPosition());
 
     if (gridContainsMouse())
     {
@@ -848,22 +1059,35 @@ void LevelEditorState::drawHighlightSquare()
 
 void LevelEditorState::drawGridSprites()
 {
-    vector<sf::Sprite> walls;
-    sf::Vector2i index;
+    // Only the chunks that overlap the view are drawn
+    auto visibleArea = camera_.getVisibleArea();
+    auto firstChunk = getChunk(map2GridIndex(sf::Vector2f{visibleArea.left, visibleArea.top}));
+    auto lastChunk = getChunk(map2GridIndex(sf::Vector2f{visibleArea.left + visibleArea.width, visibleArea.top + visibleArea.height}));
+
+    vector<const sf::Sprite*> walls;
 
-    for (auto const& [pos, sprite] : gridSprites_)
+    for (auto row = firstChunk.y; row <= lastChunk.y; row++)
     {
-        index = map2GridIndex(sf::Vector2f{pos.first,pos.second});
+        for (auto col = firstChunk.x; col <= lastChunk.x; col++)
+        {
+            auto chunk = gridChunks_.find(sf::Vector2i{col,row});
 
-        if (layout_[index.y].at(index.x) == 'W' || layout_[index.y].at(index.x) == 'C')
-            walls.push_back(sprite);
-        else
-            game_->window.draw(sprite);
+            if (chunk == gridChunks_.end())
+                continue;
+
+            for (auto const& [index, sprite] : chunk->second)
+            {
+                if (layout_[index.y].at(index.x) == 'W' || layout_[index.y].at(index.x) == 'C')
+                    walls.push_back(&sprite);
+                else
+                    game_->window.draw(sprite);
+            }
+        }
     }
 
     // Draw walls last
-    for (auto& wall : walls)
-        game_->window.draw(wall);
+    for (auto wall : walls)
+        game_->window.draw(*wall);
 }
 
 void LevelEditorState::drawLinkLines()
@@ -879,7 +1103,7 @@ void LevelEditorState::drawDanglingLink()
     if (!isKeySelected_)
         return;
 
-    auto mousePos = game_->window.mapPixelToCoords(sf::Mouse::getPosition(game_->window));
+    auto mousePos = getMouseGridPosition();
 
     auto length = sqrtf(pow(selectedKeyPos_.x - mousePos.x,2) + pow(selectedKeyPos_.y - mousePos.y,2));
     auto radians = atan2(selectedKeyPos_.y - mousePos.y, selectedKeyPos_.x - mousePos.x);
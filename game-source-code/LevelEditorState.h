@@ -13,6 +13,7 @@
 #include "State.h"
 #include "GameLoop.h"
 #include "Button.h"
+#include "Camera.h"
 
 #include <vector>
 
@@ -29,6 +30,8 @@ extern bool operator<(const Vector2i& left, const Vector2i& right);
 /// \brief The state that coordinates the user input, internal logic and rendering required for a user to design, build and save their own custom maze.
 ///
 /// The editor is presented as a GUI containing the maze grid, and several buttons and key inputs that allow the user to choose the following settings of the maze: tile type and arrangemnt of tiles, the rotation of each tile, the linkage between keys and doors, the start positions of the characters and the name of the maze. The user can then save the maze, which writes their design to text files to be loaded later in the EndlessLevelState
+///
+/// The grid can be any size from MIN_GRID_TILES to MAX_GRID_TILES tiles a side. A grid larger than the area of the screen set aside for it scrolls, with a Camera that the grid lines, tiles, key links and character heads are drawn through. The placed tiles are kept in square chunks of MAZE_CHUNK_SIZE tiles a side, and only the chunks in view are drawn, so the cost of drawing the grid depends on the size of the view rather than the grid
 
 class LevelEditorState: public State
 {
@@ -60,14 +63,16 @@ public:
     
     /// Constructor.
     /// @param game a shared pointer to a structure containing the game's state machine, asset manager, input manager and display window
-    LevelEditorState(gamePtr game);
+    /// @param numRows the number of rows in the grid
+    /// @param numCols the number of columns in the grid
+    LevelEditorState(gamePtr game, int numRows = NUM_ROWS, int numCols = NUM_COLS);
 
     /// Load the buttons, grid and textbox using the asset manager.
     void initialise() override;
     
     /// Process the user input using the input manager.
     ///
-    /// The following input events are monitored: exit request, mouse button clicks (selecting buttons and textbox), text entered event (for entering the maze name), key pressed events for 'R' (rotate), 'C' (clear), BACKSPACE (delete maze name) and ENTER (confirm maze name)
+    /// The following input events are monitored: exit request, mouse button clicks (selecting buttons and textbox), text entered event (for entering the maze name), key pressed events for 'R' (rotate), 'C' (clear), the arrow keys (scroll the grid, or add and remove rows and columns while SHIFT is held), BACKSPACE (delete maze name) and ENTER (confirm maze name)
     void processInput() override;
     
     /// Update the state of the grid and its contents, the selection and rotation of the buttons and the textbox letters.
@@ -79,7 +84,9 @@ public:
     void draw(float dt) override;
 
 private:
-    const sf::FloatRect gridBounds_{GRID_POSITION, GRID_SIZE};
+    typedef map<sf::Vector2i, sf::Sprite> spriteChunk; /**\typedef for the sprites of the tiles placed in one chunk of the grid, indexed by (col,row), to improve readability */
+
+    const sf::FloatRect gridBounds_{GRID_POSITION, GRID_SIZE};  // the part of the screen showing the grid
 
     gamePtr game_;
 
@@ -90,10 +97,15 @@ private:
     BuildSelection previousSelection_ = BuildSelection::NOTHING;
 
     // Grid
+    int numRows_;
+    int numCols_;
+    Camera camera_{gridBounds_};
+    sf::Vector2i scroll_{0,0};      // the column and row of the tile in the top left corner of the view
     vector<sf::Vertex> gridLines_;
-    vector<sf::Text> gridNumbers_;
+    vector<sf::Text> rowNumbers_;
+    vector<sf::Text> colNumbers_;
     sf::RectangleShape highlightSquare_;
-    map<pair<float, float>, sf::Sprite> gridSprites_;
+    map<sf::Vector2i, spriteChunk> gridChunks_;     // indexed by the (col,row) of the chunk
     sf::Texture bgTexture_;
     sf::Sprite background_;
 
@@ -113,8 +125,8 @@ private:
     sf::RectangleShape linkLine_;
 
     // Maze data
-    vector<string> layout_{NUM_ROWS, string(NUM_COLS,'E')};
-    vector<string> rotationMap_{NUM_ROWS, string(NUM_COLS,'0')};
+    vector<string> layout_;
+    vector<string> rotationMap_;
 
     /*------------- Private helper functions -------------*/
 
@@ -128,6 +140,7 @@ private:
     void loadHighlightSquare();
     void loadKeyLinkLine();
     void loadTextBox();
+    void resetCharacters();
 
     // Handling input
     void deselectKey();
@@ -144,12 +157,22 @@ private:
     void selectKey();
     void addGate();
     void rotateSelectedSprite();
+    void scrollGrid(sf::Vector2i direction);
+    void resizeGrid(int numRows, int numCols);
 
     // Updating state elements
     void updateButtons();
     void updateGrid();
+    void updateCamera();
+    void updateGridNumbers();
     bool isMousePressed();
     bool gridContainsMouse();
+    bool isHover(BuildSelection selection, const Button& button);
+    bool isOnGrid(BuildSelection selection);
+    sf::Vector2f getMouseGridPosition();
+    sf::View getGridView();
+    sf::FloatRect getGridArea();
+    sf::Vector2i getChunk(sf::Vector2i index);
     void removeGridSprite(sf::Vector2f position);
     void addGridSprite(sf::Vector2f position);
     void updateKeyMap(sf::Vector2f position, sf::Vector2i index);
@@ -165,6 +188,7 @@ private:
 
     // Rendering state elements
     void drawButtons();
+    void drawCharacters();
     void drawGrid();
     void drawGridNumbers();
     void drawHighlightSquare();
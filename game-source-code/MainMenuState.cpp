@@ -5,6 +5,7 @@
 #include "HighScoreState.h"
 #include "TutorialState.h"
 #include "CreditsState.h"
+#include "ReplayState.h"
 #include "Configuration.h"
 
 #include <iostream>
@@ -16,59 +17,73 @@ MainMenuState::MainMenuState(gamePtr game): game_{game}
 
 void MainMenuState::initialise()
 {
-    if (game_->assetManager.getStatus("unravel") != sf::SoundSource::Status::Playing)
+    if (game_->assetManager.getStatus(Song::UNRAVEL) != sf::SoundSource::Status::Playing)
     {
-        game_->assetManager.playSong("unravel");
-        game_->assetManager.setLoop("unravel", true);
+        game_->assetManager.playSong(Song::UNRAVEL);
+        game_->assetManager.setLoop(Song::UNRAVEL, true);
     }
 
     loadTitle(game_->assetManager);
 
     loadButtons(game_->assetManager);
+
+    loadLayer();
 }
 
 void MainMenuState::processInput()
 {
     sf::Event event;
 
-    while (game_->window.pollEvent(event))
+    while (game_->inputManager.pollEvent(game_->window, event))
     {
         if (game_->inputManager.isExitRequest(event))
-            game_->window.close();
+            game_->closeWindow();
         
         if (event.type == sf::Event::Resized)
             game_->view = game_->inputManager.getLetterboxView(game_->view, event.size.width, event.size.height);
 
+        // Watch the last level that was played
+        if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::R)
+        {
+            game_->assetManager.loadReplay(LAST_REPLAY_FILEPATH);
+
+            if (game_->assetManager.getReplay().getLength() > 0)
+            {
+                game_->assetManager.stopSong(Song::UNRAVEL);
+                game_->stateMachine.addState(make_unique<ReplayState>(game_, game_->assetManager.getReplay()));
+            }
+        }
+
         if (event.type == sf::Event::MouseButtonPressed)
         {
             if (playButton_.isHover(game_->window))
             {
-                game_->assetManager.playSound("button click");
+                game_->assetManager.playSound(Sound::BUTTON_CLICK);
                 game_->stateMachine.addState(make_unique<MazeSelectState>(game_));
             }
 
             if (levelEditorButton_.isHover(game_->window))
             {
-                game_->assetManager.playSound("button click");
+                game_->assetManager.playSound(Sound::BUTTON_CLICK);
                 game_->stateMachine.addState(make_unique<LevelEditorState>(game_));
             }
 
             if (highScoresButton_.isHover(game_->window))
             {
-                game_->assetManager.playSound("button click");
+                game_->assetManager.playSound(Sound::BUTTON_CLICK);
                 game_->stateMachine.addState(make_unique<HighScoreState>(game_));
             }
 
             if (how2PlayButton_.isHover(game_->window))
             {
-                game_->assetManager.playSound("button click");
+                game_->assetManager.playSound(Sound::BUTTON_CLICK);
                 game_->stateMachine.addState(make_unique<TutorialState>(game_));
             }
 
             if (creditsButton_.isHover(game_->window))
             {
-                game_->assetManager.playSound("button click");
-                game_->assetManager.stopSong("unravel");
+                game_->assetManager.playSound(Sound::BUTTON_CLICK);
+                game_->assetManager.stopSong(Song::UNRAVEL);
                 game_->stateMachine.addState(make_unique<CreditsState>(game_));
             }
         }
@@ -89,13 +104,7 @@ void MainMenuState::draw(float dt)
     game_->window.clear();
     game_->window.setView(game_->view);
 
-    game_->window.draw(bg);
-    game_->window.draw(title_);
-    game_->window.draw(playButton_);
-    game_->window.draw(levelEditorButton_);
-    game_->window.draw(highScoresButton_);
-    game_->window.draw(how2PlayButton_);
-    game_->window.draw(creditsButton_);
+    game_->window.draw(layer_);
 
     game_->window.display();
 }
@@ -153,3 +162,15 @@ void MainMenuState::loadButtons(AssetManager& assetManager)
     creditsButton_.setTextScale(0.8f, 0.8f);
 
 }
+
+void MainMenuState::loadLayer()
+{
+    // Nothing on the menu moves, so it is only rendered again when a button is hovered over
+    layer_.add(bg);
+    layer_.add(title_);
+    layer_.add(playButton_);
+    layer_.add(levelEditorButton_);
+    layer_.add(highScoresButton_);
+    layer_.add(how2PlayButton_);
+    layer_.add(creditsButton_);
+}
@@ -6,6 +6,7 @@
 #include "State.h"
 #include "GameLoop.h"
 #include "Button.h"
+#include "RenderLayer.h"
 
 class MainMenuState: public State
 {
@@ -19,6 +20,7 @@ public:
     void processInput() override;
     void update(float dt) override;
     void draw(float dt) override;
+    float getIdleTimeout() const override {return IDLE_TIMEOUT;}
 
 private:
     gamePtr game_;
@@ -32,9 +34,12 @@ private:
     
     sf::Sprite bg;
 
+    RenderLayer layer_{SCREEN_AREA};
+
     // Private helper functions
     void loadTitle(AssetManager& assetManager);
     void loadButtons(AssetManager& assetManager);
+    void loadLayer();
 
 };
 
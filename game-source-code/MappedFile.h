@@ -0,0 +1,55 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+/// \file MappedFile.h
+/// \brief Contains the class definition for the "MappedFile" class
+
+#include <cstddef>
+#include <string>
+
+using namespace std;
+
+/// \class MappedFile
+/// \brief A read-only view of a whole file, mapped into memory
+///
+/// The file's contents are paged in by the operating system as they are read, rather than being copied into a buffer, so opening even a large file is a single system call and several readers can share the same pages. The contents stay valid until the file is closed, so anything that is read from them without being copied (e.g. an SFML font or music stream) must not outlive the MappedFile.
+
+class MappedFile
+{
+public:
+    /// Default constructor
+    MappedFile() {}
+
+    /// Destructor, which unmaps the file
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// Map a file into memory
+    /// @param filePath the path of the file
+    /// \return true if the file was mapped, and false if it could not be opened or is empty
+    bool open(const string& filePath);
+
+    /// Unmap the file, if one is open
+    void close();
+
+    /// Check whether a file is open
+    /// \return true if a file is open, and false otherwise
+    bool isOpen() const {return data_ != nullptr;}
+
+    /// Get the contents of the file
+    /// \return a pointer to the first byte of the file, or nullptr if no file is open
+    const unsigned char* getData() const {return data_;}
+
+    /// Get the size of the file
+    /// \return the number of bytes in the file
+    size_t getSize() const {return size_;}
+
+private:
+    const unsigned char* data_ = nullptr;
+    size_t size_ = 0;
+    void* mapping_ = nullptr;       // the handle of the file mapping, where the platform needs one
+};
+
+#endif
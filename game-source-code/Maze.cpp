@@ -1,15 +1,12 @@
 #include "Maze.h"
 
-#include "EmptyTile.h"
-#include "WallTile.h"
-#include "GateTile.h"
-#include "KeyTile.h"
-#include "FruitTile.h"
-#include "PowerTile.h"
-#include "SuperTile.h"
+#include "Configuration.h"
 
 #include <string>
 #include <iostream>
+#include <cmath>
+#include <queue>
+#include <algorithm>
 
 Maze::Maze(Data mazeData, Textures mazeTextures, Observers mazeObservers, sf::Vector2f topLeftPos, float tileLength):
 mazeData_{mazeData},
@@ -21,63 +18,170 @@ width_{mazeData.layout[0].size() * tileLength},
 height_{mazeData.layout.size() * tileLength},
 offset_{topLeftPos_ + sf::Vector2f{tileLength_/2, tileLength_/2}}
 {
-    foodCount_ = 0;
     createMaze();
+    createRenderer();
+    createObservers();
+    createDistanceFields();
 }
 
-void Maze::update()
+void Maze::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
-    for (auto& row : maze_)
-        for (auto& col : row)
-            updateTile(col);
+    target.draw(renderer_, states);
 }
 
-void Maze::draw(sf::RenderTarget& target, sf::RenderStates states) const
+void Maze::activate(sf::Vector2f position)
 {
-    auto walls = vector<tilePtr>{};
+    auto index = getIndex(position);
+
+    if (index < 0)
+        return;
 
-    // Draw everything except walls and corners first
-    for (auto col = 0; col < mazeData_.layout[0].size(); col++)
+    auto& tile = tiles_[index];
+
+    switch (tile.type)
     {
-        for (auto row = 0; row < mazeData_.layout.size(); row++)
-        {
-            if (mazeData_.layout[row].at(col) == 'W' || mazeData_.layout[row].at(col) == 'C')
-                walls.push_back(maze_[col][row]);
-            else
-                target.draw(maze_[col][row]->getSprite());
-        }
+        case TileType::FRUIT:
+            notify(tileObservers_[static_cast<int>(tile.type)], Observer::Event::FRUIT_EATEN);
+            foodCount_--;
+            tile.type = TileType::EMPTY;
+            renderer_.updateTile(index, getTextureIndex(tile));
+            break;
+        case TileType::POWER_PELLET:
+            notify(tileObservers_[static_cast<int>(tile.type)], Observer::Event::POWER_PELLET_EATEN);
+            foodCount_--;
+            tile.type = TileType::EMPTY;
+            renderer_.updateTile(index, getTextureIndex(tile));
+            break;
+        case TileType::SUPER_PELLET:
+            notify(tileObservers_[static_cast<int>(tile.type)], Observer::Event::SUPER_PELLET_EATEN);
+            foodCount_--;
+            tile.type = TileType::EMPTY;
+            renderer_.updateTile(index, getTextureIndex(tile));
+            break;
+        case TileType::KEY:
+            notify(tileObservers_[static_cast<int>(tile.type)], Observer::Event::KEY_EATEN);
+
+            for (auto gate : keyGates_[tile.payload])
+            {
+                tiles_[gate].type = TileType::EMPTY;
+                openTile(gate);
+                renderer_.updateTile(gate, getTextureIndex(tiles_[gate]));
+            }
+            createDistanceFields();
+
+            tile.type = TileType::EMPTY;
+            tile.payload = -1;
+            renderer_.updateTile(index, getTextureIndex(tile));
+            break;
+        case TileType::GATE:
+            if (!(tile.flags & BROKEN))
+            {
+                notify(tileObservers_[static_cast<int>(tile.type)], Observer::Event::GATE_BROKEN);
+                tile.flags |= BROKEN;
+                openTile(index);
+                createDistanceFields();
+                renderer_.updateTile(index, getTextureIndex(tile));
+            }
+            break;
+        default:
+            break;
     }
+}
+
+Maze::TileType Maze::getTileType(sf::Vector2f position) const
+{
+    auto index = getIndex(position);
+
+    if (index < 0)
+        return TileType::WALL;
 
-    // Draw walls and corners
-    for (auto wall : walls)
-        target.draw(wall->getSprite());
+    return tiles_[index].type;
 }
 
-Maze::tilePtr Maze::getTile(sf::Vector2f position)
+sf::Vector2f Maze::getTilePosition(sf::Vector2f position) const
 {
-    auto yPos = static_cast<int>((position.y - topLeftPos_.y)/tileLength_);
-    auto xPos = static_cast<int>((position.x - topLeftPos_.x)/tileLength_);
+    auto row = static_cast<int>((position.y - topLeftPos_.y)/tileLength_);
+    auto col = static_cast<int>((position.x - topLeftPos_.x)/tileLength_);
 
-    return maze_[xPos][yPos];
+    return offset_ + sf::Vector2f{col * tileLength_, row * tileLength_};
 }
 
 vector<sf::Vector2f> Maze::getNodes() const
 {
     vector<sf::Vector2f> nodes;
 
-    for (auto row : maze_)
-        for (auto col : row)
-            if (col->isNode())
-                nodes.push_back(col->getPosition());
+    for (auto col = 0; col < numCols_; col++)
+    {
+        for (auto row = 0; row < numRows_; row++)
+        {
+            auto& tile = tiles_[row*numCols_ + col];
+
+            if ((tile.flags & NODE) || (gatesArePassable_ && tile.type == TileType::GATE))
+                nodes.push_back(getPosition(row*numCols_ + col));
+        }
+    }
 
     return nodes;
 }
 
+bool Maze::isNode(sf::Vector2f position) const
+{
+    auto index = getIndex(position);
+
+    if (index < 0)
+        return false;
+
+    auto& tile = tiles_[index];
+
+    return (tile.flags & NODE) || (tile.type == TileType::GATE && gatesArePassable_);
+}
+
+bool Maze::isOpenNode(sf::Vector2f position) const
+{
+    auto index = getIndex(position);
+
+    if (index < 0)
+        return false;
+
+    return tiles_[index].flags & NODE;
+}
+
+bool Maze::isNeighbourNode(sf::Vector2f position, sf::Vector2f direction) const
+{
+    auto index = getIndex(position);
+
+    if (index < 0)
+        return false;
+
+    return tiles_[index].neighbours & dir2Mask(direction);
+}
+
+int Maze::getPathLength(sf::Vector2f position, sf::Vector2f target)
+{
+    auto index = getIndex(position);
+
+    if (index < 0)
+        return -1;
+
+    return getDistanceField(getTargetIndex(target))[index];
+}
+
+void Maze::setSharedTarget(sf::Vector2f target)
+{
+    auto targetIndex = getTargetIndex(target);
+
+    if (targetIndex == sharedTarget_)
+        return;
+
+    sharedTarget_ = targetIndex;
+    findDistances(sharedTarget_, sharedField_);
+}
+
 sf::Vector2f Maze::getPlayerStart() const
 {
     auto position = mazeData_.startPos[0];
 
-    return maze_[position.x][position.y]->getPosition();
+    return getPosition(position.y*numCols_ + position.x);
 }
 
 
@@ -90,7 +194,7 @@ vector<sf::Vector2f> Maze::getEnemyStarts() const
     auto positions = vector<sf::Vector2f>{first, last};
 
     for (auto pos : positions)
-        coords.push_back(maze_[pos.x][pos.y]->getPosition());
+        coords.push_back(getPosition(pos.y*numCols_ + pos.x));
 
     return coords;
 }
@@ -103,149 +207,415 @@ tuple<sf::Vector2f,sf::Vector2f> Maze::getMazeBounds() const
     return make_tuple(topLeftCorner, bottomRightCorner);
 }
 
-bool Maze::isClear()
+bool Maze::isClear() const
 {
     return (foodCount_ <= 0);
 }
 
 /*------------- Private helper functions -------------*/
 
-void Maze::updateTile(Maze::tilePtr& tile)
+void Maze::createMaze()
+{
+    numRows_ = mazeData_.layout.size();
+    numCols_ = mazeData_.layout[0].size();
+
+    tiles_.clear();
+    tiles_.reserve(numRows_*numCols_);
+
+    for (auto row = 0; row < numRows_; row++)
+        for (auto col = 0; col < numCols_; col++)
+            tiles_.push_back(assignTile(row, col));
+
+    applyKeyMap(mazeData_.keyMap);
+
+    for (auto index = 0; index < numRows_*numCols_; index++)
+        updateNeighbours(index);
+}
+
+void Maze::createRenderer()
+{
+    // Atlas entries are in the same order as TileType, followed by the broken gate
+    auto textures = vector<texturePtr>{mazeTextures_.empty,
+                                       mazeTextures_.wall,
+                                       mazeTextures_.corner,
+                                       mazeTextures_.gate,
+                                       mazeTextures_.key,
+                                       mazeTextures_.fruit,
+                                       mazeTextures_.powerPellet,
+                                       mazeTextures_.superPellet,
+                                       mazeTextures_.brokenGate};
+
+    renderer_ = MazeRenderer{textures, numRows_, numCols_};
+
+    for (auto index = 0; index < numRows_*numCols_; index++)
+    {
+        auto& tile = tiles_[index];
+        auto isWall = (tile.type == TileType::WALL || tile.type == TileType::CORNER);
+
+        renderer_.addTile(index, getPosition(index), getTextureIndex(tile), tile.rotation, isWall);
+    }
+}
+
+int Maze::getTextureIndex(const TileRecord& tile) const
 {
-    // tile->update(); // Uncomment for tile animations
+    if (tile.type == TileType::GATE && (tile.flags & BROKEN))
+        return static_cast<int>(TileType::SUPER_PELLET) + 1;
 
-    if (tile->isRemoved())
+    return static_cast<int>(tile.type);
+}
+
+Maze::TileRecord Maze::assignTile(int row, int col)
+{
+    auto tile = TileRecord{};
+    tile.rotation = char2Rotation(mazeData_.rotationMap[row].at(col));
+    tile.flags = NODE;
+
+    switch (mazeData_.layout[row].at(col))
     {
-        tile = make_shared<EmptyTile>(tile->getPosition(), tile->getAngle(), mazeTextures_.empty);
+        case 'E':
+            tile.type = TileType::EMPTY;
+            break;
+        case 'W':
+            tile.type = TileType::WALL;
+            tile.flags = 0;
+            break;
+        case 'C':
+            tile.type = TileType::CORNER;
+            tile.flags = 0;
+            break;
+        case 'G':
+            tile.type = TileType::GATE;
+            tile.flags = 0;
+            break;
+        case 'K':
+            tile.type = TileType::KEY;
+            break;
+        case 'F':
+            tile.type = TileType::FRUIT;
+            foodCount_++;
+            break;
+        case 'P':
+            tile.type = TileType::POWER_PELLET;
+            foodCount_++;
+            break;
+        case 'S':
+            tile.type = TileType::SUPER_PELLET;
+            foodCount_++;
+            break;
+        default:
+            cout << "Error: No match for layout key" << endl; // Throw Exception
+            tile.type = TileType::EMPTY;
+            break;
     }
+
+    return tile;
 }
 
-void Maze::createMaze()
+void Maze::applyKeyMap(posKeyMap keyMap)
 {
-    vector<Maze::tilePtr> columnOfTiles{};
+    keyGates_.clear();
+
+    for (auto& [keyPos, gatePos] : keyMap)
+    {
+        auto gates = vector<int>{};
+
+        for (auto& pos : gatePos)
+            gates.push_back(get<1>(pos)*numCols_ + get<0>(pos));
+
+        tiles_[get<1>(keyPos)*numCols_ + get<0>(keyPos)].payload = keyGates_.size();
+        keyGates_.push_back(gates);
+    }
 
-    for (auto col = 0; col < mazeData_.layout[0].size(); col++)
+    // Keys placed in the level editor without any gates linked to them open nothing
+    for (auto& tile : tiles_)
     {
-        columnOfTiles = {};
-        for (auto row = 0; row < mazeData_.layout.size(); row++)
+        if (tile.type == TileType::KEY && tile.payload < 0)
         {
-            columnOfTiles.push_back(assignTile(row, col));
+            tile.payload = keyGates_.size();
+            keyGates_.push_back(vector<int>{});
         }
-        maze_.push_back(columnOfTiles);
     }
+}
 
-    applyKeyMap(mazeData_.keyMap);
+void Maze::openTile(int index)
+{
+    tiles_[index].flags |= NODE;
+
+    auto row = index / numCols_;
+    auto col = index % numCols_;
+
+    updateNeighbours(index);
+    if (row > 0) updateNeighbours(index - numCols_);
+    if (row < numRows_ - 1) updateNeighbours(index + numCols_);
+    if (col > 0) updateNeighbours(index - 1);
+    if (col < numCols_ - 1) updateNeighbours(index + 1);
+}
+
+void Maze::updateNeighbours(int index)
+{
+    auto row = index / numCols_;
+    auto col = index % numCols_;
+    unsigned char mask = 0;
+
+    if (row > 0 && (tiles_[index - numCols_].flags & NODE))
+        mask |= dir2Mask(UP);
+    if (col < numCols_ - 1 && (tiles_[index + 1].flags & NODE))
+        mask |= dir2Mask(RIGHT);
+    if (row < numRows_ - 1 && (tiles_[index + numCols_].flags & NODE))
+        mask |= dir2Mask(DOWN);
+    if (col > 0 && (tiles_[index - 1].flags & NODE))
+        mask |= dir2Mask(LEFT);
+
+    tiles_[index].neighbours = mask;
+}
+
+void Maze::createDistanceFields()
+{
+    // The enemies head for the corners when they scatter, and for their start positions (their pen) when they are dead
+    auto targets = vector<int>{0, numCols_ - 1, (numRows_ - 1)*numCols_, numRows_*numCols_ - 1};
 
-    for (auto pos : keyPos_)
+    for (auto i = 1u; i < mazeData_.startPos.size(); i++)
     {
-        auto position = offset_ + sf::Vector2f{get<0>(pos) * tileLength_, get<1>(pos) * tileLength_};
-        auto angle = char2Angle(mazeData_.rotationMap[get<1>(pos)].at(get<0>(pos)));
+        auto start = mazeData_.startPos[i];
 
-        auto keyTile =  make_shared<KeyTile>(position, angle, mazeTextures_.key, keyMap_[pos]);
+        if (start.x >= 0 && start.x < numCols_ && start.y >= 0 && start.y < numRows_)
+            targets.push_back(static_cast<int>(start.y)*numCols_ + static_cast<int>(start.x));
+    }
 
-        keyTile->addObserver(mazeObservers_.soundBoard);
-        maze_[get<0>(pos)][get<1>(pos)] = keyTile;
+    fixedFields_.clear();
+    for (auto target : targets)
+    {
+        if (fixedFields_.count(target) == 0)
+            findDistances(target, fixedFields_[target]);
     }
+
+    if (sharedTarget_ >= 0)
+        findDistances(sharedTarget_, sharedField_);
+
+    recentFields_.clear();
 }
 
-Maze::tilePtr Maze::assignTile(int row, int col)
+const vector<int>& Maze::getDistanceField(int targetIndex)
 {
-    auto position = offset_ + sf::Vector2f{col * tileLength_, row * tileLength_};
-    auto angle = char2Angle(mazeData_.rotationMap[row].at(col));
+    if (targetIndex == sharedTarget_)
+        return sharedField_;
 
-    switch (mazeData_.layout[row].at(col))
+    auto fixedField = fixedFields_.find(targetIndex);
+
+    if (fixedField != fixedFields_.end())
+        return fixedField->second;
+
+    auto recentField = find_if(recentFields_.begin(), recentFields_.end(),
+                               [targetIndex](const pair<int,vector<int>>& field){return field.first == targetIndex;});
+
+    if (recentField != recentFields_.end())
     {
-        case 'E':
-            return make_shared<EmptyTile>(position, angle, mazeTextures_.empty);
-        case 'W':
-            return make_shared<WallTile>(position, angle, mazeTextures_.wall);
-        case 'C':
-            return make_shared<WallTile>(position, angle, mazeTextures_.corner);
-        case 'G':
+        recentFields_.splice(recentFields_.begin(), recentFields_, recentField);
+        return recentFields_.front().second;
+    }
+
+    // The least recently used distances are reused for the new target
+    if (recentFields_.size() >= MAX_RECENT_FIELDS)
+        recentFields_.splice(recentFields_.begin(), recentFields_, prev(recentFields_.end()));
+    else
+        recentFields_.emplace_front();
+
+    recentFields_.front().first = targetIndex;
+    findDistances(targetIndex, recentFields_.front().second);
+
+    return recentFields_.front().second;
+}
+
+void Maze::findDistances(int targetIndex, vector<int>& distances) const
+{
+    distances.assign(tiles_.size(), -1);
+
+    auto start = getNearestNode(targetIndex);
+
+    if (start < 0)
+        return;
+
+    // Search outwards from the target: a tile is one move further away than an open node next to it
+    auto frontier = queue<int>{};
+    distances[start] = 0;
+    frontier.push(start);
+
+    while (!frontier.empty())
+    {
+        auto index = frontier.front();
+        frontier.pop();
+
+        if (!(tiles_[index].flags & NODE))
+            continue;
+
+        auto row = index / numCols_;
+        auto col = index % numCols_;
+        int neighbours[] = {row > 0 ? index - numCols_ : getWrappedNode(index, UP),
+                            col < numCols_ - 1 ? index + 1 : getWrappedNode(index, RIGHT),
+                            row < numRows_ - 1 ? index + numCols_ : getWrappedNode(index, DOWN),
+                            col > 0 ? index - 1 : getWrappedNode(index, LEFT)};
+
+        for (auto neighbour : neighbours)
         {
-            auto gate = make_shared<GateTile>(position, angle, mazeTextures_.gate, mazeTextures_.brokenGate);
-            gate->addObserver(mazeObservers_.soundBoard);
-            return gate;
+            if (neighbour < 0 || distances[neighbour] >= 0)
+                continue;
+
+            distances[neighbour] = distances[index] + 1;
+            frontier.push(neighbour);
         }
-        case 'K':
-            keyPos_.push_back(make_tuple(col, row));
-            return nullptr;
-        case 'F':
+    }
+}
+
+int Maze::getTargetIndex(sf::Vector2f target) const
+{
+    auto col = static_cast<int>(floor((target.x - topLeftPos_.x)/tileLength_));
+    auto row = static_cast<int>(floor((target.y - topLeftPos_.y)/tileLength_));
+
+    col = max(0, min(col, numCols_ - 1));
+    row = max(0, min(row, numRows_ - 1));
+
+    return row*numCols_ + col;
+}
+
+int Maze::getWrappedNode(int index, sf::Vector2f direction) const
+{
+    // Characters moving off an edge of the maze reappear on the opposite edge, if the tile there is an open node
+    auto row = index / numCols_;
+    auto col = index % numCols_;
+
+    if (direction == UP) row = numRows_ - 1;
+    else if (direction == DOWN) row = 0;
+    else if (direction == LEFT) col = numCols_ - 1;
+    else if (direction == RIGHT) col = 0;
+
+    auto wrapped = row*numCols_ + col;
+
+    if (wrapped == index || !(tiles_[wrapped].flags & NODE))
+        return -1;
+
+    return wrapped;
+}
+
+int Maze::getNearestNode(int index) const
+{
+    // Search outwards through every tile (including walls) until an open node is found
+    auto visited = vector<bool>(tiles_.size(), false);
+    auto frontier = queue<int>{};
+    visited[index] = true;
+    frontier.push(index);
+
+    while (!frontier.empty())
+    {
+        index = frontier.front();
+        frontier.pop();
+
+        if (tiles_[index].flags & NODE)
+            return index;
+
+        auto row = index / numCols_;
+        auto col = index % numCols_;
+        int neighbours[] = {row > 0 ? index - numCols_ : -1,
+                            col < numCols_ - 1 ? index + 1 : -1,
+                            row < numRows_ - 1 ? index + numCols_ : -1,
+                            col > 0 ? index - 1 : -1};
+
+        for (auto neighbour : neighbours)
         {
-            auto fruit = make_shared<FruitTile>(position, angle, mazeTextures_.fruit);
-            fruit->addObserver(mazeObservers_.scoreBoard);
-            fruit->addObserver(mazeObservers_.soundBoard);
-            incrementFoodCount();
-            return fruit;
+            if (neighbour < 0 || visited[neighbour])
+                continue;
+
+            visited[neighbour] = true;
+            frontier.push(neighbour);
         }
-        case 'P':
-        {
-            auto pellet = make_shared<PowerTile>(position, angle, mazeTextures_.powerPellet);
+    }
 
-            pellet->addObserver(mazeObservers_.player);
+    return -1;
+}
 
-            for (auto enemy : mazeObservers_.enemies)
-                pellet->addObserver(enemy);
+void Maze::notify(const vector<Observer*>& observers, Observer::Event event) const
+{
+    for (auto observer : observers)
+        observer->onNotify(event);
+}
 
-            pellet->addObserver(mazeObservers_.scoreBoard);
-            pellet->addObserver(mazeObservers_.soundBoard);
-            incrementFoodCount();
-            return pellet;
-        }
-        case 'S':
-        {
-            auto pellet = make_shared<SuperTile>(position, angle, mazeTextures_.superPellet);
+void Maze::createObservers()
+{
+    // The observers of each tile type are found once, rather than each time a tile is activated
+    tileObservers_.assign(static_cast<int>(TileType::SUPER_PELLET) + 1, vector<Observer*>{});
 
-            pellet->addObserver(mazeObservers_.player);
+    for (auto type = 0u; type < tileObservers_.size(); type++)
+    {
+        auto& observers = tileObservers_[type];
 
-            for (auto enemy : mazeObservers_.enemies)
-                pellet->addObserver(enemy);
-            
-            pellet->addObserver(mazeObservers_.scoreBoard);
-            pellet->addObserver(mazeObservers_.soundBoard);
-            incrementFoodCount();
-            return pellet;
+        switch (static_cast<TileType>(type))
+        {
+            case TileType::POWER_PELLET:
+            case TileType::SUPER_PELLET:
+                observers.push_back(mazeObservers_.player);
+                observers.insert(observers.end(), mazeObservers_.enemies.begin(), mazeObservers_.enemies.end());
+                // fall through
+            case TileType::FRUIT:
+                observers.push_back(mazeObservers_.scoreBoard);
+                // fall through
+            case TileType::GATE:
+            case TileType::KEY:
+                observers.push_back(mazeObservers_.soundBoard);
+                break;
+            default:
+                break;
         }
-        default:
-            cout << "Error: No match for layout key" << endl; // Throw Exception
-            return make_shared<EmptyTile>(position, angle, mazeTextures_.empty);
+
+        observers.erase(remove(observers.begin(), observers.end(), nullptr), observers.end());
     }
 }
 
-float Maze::char2Angle(char c) const
+int Maze::getIndex(sf::Vector2f position) const
+{
+    auto col = static_cast<int>(floor((position.x - topLeftPos_.x)/tileLength_));
+    auto row = static_cast<int>(floor((position.y - topLeftPos_.y)/tileLength_));
+
+    if (col < 0 || col >= numCols_ || row < 0 || row >= numRows_)
+        return -1;
+
+    return row*numCols_ + col;
+}
+
+sf::Vector2f Maze::getPosition(int index) const
+{
+    auto row = index / numCols_;
+    auto col = index % numCols_;
+
+    return offset_ + sf::Vector2f{col * tileLength_, row * tileLength_};
+}
+
+unsigned char Maze::char2Rotation(char c) const
 {
     switch (c)
     {
         case '0':
-            return 0.f;
+            return 0;
         case '1':
-            return 90.f;
+            return 1;
         case '2':
-            return 180.f;
+            return 2;
         case '3':
-            return 270.f;
+            return 3;
         default:
             cout << "Error: No match for rotation key" << endl;   // Replace with exception
-            return 0.f;
+            return 0;
     }
 }
 
-void Maze::applyKeyMap(posKeyMap keyMap)
+unsigned char Maze::dir2Mask(sf::Vector2f direction) const
 {
-    vector<tilePtr> gates;
-
-    for (auto& [keyPos, gatePos] : keyMap)
-    {
-        for (auto& pos : gatePos)
-        {
-            gates.push_back(maze_[get<0>(pos)][get<1>(pos)]);
-        }
-
-        keyMap_[keyPos] = gates;
-        gates = {};
-    }
+    if (direction == UP)
+        return 1;
+    if (direction == RIGHT)
+        return 2;
+    if (direction == DOWN)
+        return 4;
+    if (direction == LEFT)
+        return 8;
+
+    return 0;
 }
-
-/*------------- Static data members -------------*/
-
-int Maze::foodCount_ = 0;
@@ -5,16 +5,21 @@
 /// \brief Contains the class definition for the "Maze" class
 
 #include <SFML/Graphics.hpp>
-#include "Tile.h"
+#include "Configuration.h"
 #include "Observer.h"
+#include "MazeRenderer.h"
 
+#include <list>
 #include <memory>
 #include <map>
+#include <vector>
 
 /// \class Maze
 /// \brief An object that stores and manages the 2D array of tiles forming the maze itself
 ///
-/// This class stores the maze as a two-dimensional array of tile pointers, and is responsible for removing a tile when it is set for removal and providing information regarding the maze bounds, character start positions, and the tile at a given coordinate.
+/// This class stores the maze as a single contiguous array of compact tile records, addressed by row*width + col, and is responsible for applying the behaviour of a tile when it is activated and providing information regarding the maze bounds, character start positions, the nodality of each tile and the tile at a given coordinate.
+/// No object is created for each cell: the behaviour of every tile type is applied by activate(), which notifies the observers of that type of tile.
+/// A tile is replaced (e.g. food by an empty tile) in the same call that activates it, updating only that tile's record, its quad in the renderer and the nodality of its neighbours. The maze therefore has no per-frame update: its cost is proportional to the number of tiles that change, not the size of the maze.
 
 using namespace std;
 
@@ -22,10 +27,32 @@ class Maze : public sf::Drawable
 {
 public:
 
-    typedef shared_ptr<Tile> tilePtr; /**\typedef for a pointer to a Tile, to improve readability */
     typedef map<tuple<int,int>, vector<tuple<int,int>>> posKeyMap; /**\typedef for a map relating a tuple of two ints to a vector of tuples of two ints, to improve readability */
     typedef shared_ptr<sf::Texture> texturePtr; /**\typedef for a pointer to a sf::Texture, to improve readability */
-    
+
+    /// \enum The type of a tile in the maze, matching the layout keys (E, W, C, G, K, F, P, S)
+    enum class TileType : unsigned char
+    {
+        EMPTY,
+        WALL,
+        CORNER,
+        GATE,
+        KEY,
+        FRUIT,
+        POWER_PELLET,
+        SUPER_PELLET
+    };
+
+    /// \struct A compact record describing a single tile in the maze
+    struct TileRecord
+    {
+        TileType type = TileType::EMPTY;
+        unsigned char rotation = 0;     // number of clockwise quarter turns
+        unsigned char flags = 0;        // see the NODE and BROKEN flags below
+        unsigned char neighbours = 0;   // bit mask of neighbouring open nodes
+        short payload = -1;             // index into the key payload, or -1
+    };
+
     /// \struct A structure containing the data that characterises a maze, specifically the layout, rotation map, key map and start positions
     struct Data
     {
@@ -52,10 +79,10 @@ public:
     /// \struct A structure containing the observers that need to monitor each tile
     struct Observers
     {
-        Observer* player;
+        Observer* player = nullptr;
         vector<Observer*> enemies;
-        Observer* scoreBoard;
-        Observer* soundBoard;
+        Observer* scoreBoard = nullptr;
+        Observer* soundBoard = nullptr;
     };
 
     /// Default constructor
@@ -72,30 +99,78 @@ public:
     /// @param tileLength the length of all the tiles in the maze (pixels)
     Maze(Data mazeData, Textures mazeTextures, Observers mazeObservers, sf::Vector2f topLeftPos, float tileLength);
 
-    /// Updates every tile in the array.
-    ///
-    /// Removing it if it is set for removal and replacing it with an empty tile
-    void update();
-
     /// Overriding of SFML's draw function to control how the maze is drawn
     ///
-    /// The wall tile need to be drawn last to ensure that the maze appears visually correct
+    /// The maze is drawn by its MazeRenderer in two batches, with the walls drawn last to ensure that the maze appears visually correct
     /// @param target Render target to draw to
     /// @param states Current render states
     void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
-    /// Get the tile corresponding to the coordinates provided.
+    /// Get the renderer which draws the maze, e.g. to take a copy of it that can be drawn on another thread
+    /// \return a constant reference to the maze's renderer
+    const MazeRenderer& getRenderer() const {return renderer_;}
+
+    /// Performs the action specific to the tile corresponding to the coordinates provided.
+    ///
+    /// Fruit, power pellets and super pellets are eaten and replaced by an empty tile, keys open all of their gates and are replaced by an empty tile, and gates are broken. The observers of the tile are notified of the corresponding event. Empty tiles and walls have no action.
+    /// @param position coordinates in the form sf::Vector2f{x,y}
+    void activate(sf::Vector2f position);
+
+    /// Get the type of the tile corresponding to the coordinates provided.
+    /// @param position coordinates in the form sf::Vector2f{x,y}
+    ///\return the type of the tile, or TileType::WALL for positions outside of the maze
+    TileType getTileType(sf::Vector2f position) const;
+
+    /// Get the centre of the tile corresponding to the coordinates provided.
     ///
     /// The tile corresponding to the coordinates is the tile which contains the given coordinate within its area
     /// @param position coordinates in the form sf::Vector2f{x,y}
-    ///\return a shared pointer to the tile corresponding to the coordinates provided
-    tilePtr getTile(sf::Vector2f position);
+    ///\return the coordinates of the centre of the tile in the form sf::Vector2f{x,y}
+    sf::Vector2f getTilePosition(sf::Vector2f position) const;
 
     /// Returns a list of the positions of the valid movement nodes in the array
     ///
-    /// The array is iterated over and each tile is queries using the isNode() function to determine whether it should be added o the list
+    /// The list is built from the cached node flags rather than by querying every tile
     /// \return A vector of positions that are in the form sf::Vector2f{x,y}
     vector<sf::Vector2f> getNodes() const;
+
+    /// Query whether the tile containing the given coordinates is a valid movement node
+    ///
+    /// This is a constant time lookup in the tile array. Closed gates are only considered nodes while they are passable (see setGatesPassable())
+    /// @param position coordinates in the form sf::Vector2f{x,y}
+    /// \return true if the tile is a valid movement node, and false otherwise (including positions outside of the maze)
+    bool isNode(sf::Vector2f position) const;
+
+    /// Query whether the tile containing the given coordinates is an open movement node
+    ///
+    /// Unlike isNode(), closed gates are never considered to be open, even while they are passable
+    /// @param position coordinates in the form sf::Vector2f{x,y}
+    /// \return true if the tile is an open movement node, and false otherwise (including positions outside of the maze)
+    bool isOpenNode(sf::Vector2f position) const;
+
+    /// Query whether the neighbouring tile in the given direction is an open movement node
+    ///
+    /// The neighbours of every tile are precomputed when the maze is created, and are only updated when a gate is opened, so this is a constant time lookup
+    /// @param position coordinates of the current tile in the form sf::Vector2f{x,y}
+    /// @param direction one of the direction vectors UP, DOWN, LEFT or RIGHT
+    /// \return true if the neighbouring tile is an open movement node, and false otherwise
+    bool isNeighbourNode(sf::Vector2f position, sf::Vector2f direction) const;
+
+    /// Get the number of moves along the shortest path from a tile to a target
+    ///
+    /// Paths only pass through open nodes, as with isNeighbourNode(), and wrap across the edges of the maze where the tiles on both sides are open nodes, as characters do. Closed gates are never passed through, even while they are passable (see setGatesPassable()). A target outside of the maze is moved to the nearest tile inside it, and a target that is not an open node (e.g. a wall in a corner) is moved to the nearest open node.
+    ///
+    /// The distances to every tile from a target are found with a breadth-first search outwards from the target, and kept so that later queries are constant time lookups. The distances to the fixed targets (the corners of the maze and the enemies' start positions) are found when the maze is created and whenever a gate opens, and those to the shared target once each time it moves (see setSharedTarget()). The distances to any other target are found the first time they are needed, and the least recently used of these are forgotten once there are MAX_RECENT_FIELDS of them. This is not a const function, as it may add to those distances, so it must not be called from more than one thread at once.
+    /// @param position coordinates of the current tile in the form sf::Vector2f{x,y}
+    /// @param target coordinates of the target in the form sf::Vector2f{x,y}
+    /// \return the number of moves, or -1 if the target cannot be reached (including positions outside of the maze)
+    int getPathLength(sf::Vector2f position, sf::Vector2f target);
+
+    /// Set the moving target that most characters head for (the player's tile), whose distances are found once and shared by all of them
+    ///
+    /// This should be called once per update, before the characters move. The distances are only found again when the target moves to another tile or a gate opens
+    /// @param target coordinates of the target in the form sf::Vector2f{x,y}
+    void setSharedTarget(sf::Vector2f target);
     
     /// Gets the starting position for the player within the maze
     /// \return a position in the form sf::Vector2f{x,y}
@@ -113,7 +188,7 @@ public:
     
     /// Query whether there are is no more fruit, power pellets or super pellets remaining in the maze
     /// \return true if the sum of fruit, power pellets or super pellets is equal to or less than zero, and is false otherwise
-    bool isClear();
+    bool isClear() const;
 
     /// Get the length of the tiles in the maze
     /// \return a float representing the tile length (pixels)
@@ -126,36 +201,66 @@ public:
     /// Get the height of the maze
     /// \return a float representing the height of the maze
     float getHeight() const {return height_;}
-    vector<vector<tilePtr>> getMaze() const {return maze_;} // REMOVE!!!!
 
-    /// Add 1 to the food count
-    static void incrementFoodCount() {foodCount_++;}
-    
-    /// Remove 1 from the food count
-    static void decrementFoodCount() {foodCount_--;}
+    /// Allow or prevent movement through closed gates (e.g. while the player is in super mode)
+    /// @param isPassable true if closed gates should be treated as nodes, and false otherwise
+    void setGatesPassable(bool isPassable) {gatesArePassable_ = isPassable;}
+
+    /// Query whether closed gates can currently be moved through
+    /// \return true if closed gates are treated as nodes, and false otherwise
+    bool areGatesPassable() const {return gatesArePassable_;}
 
 private:
     // Private data members
     Data mazeData_;
     Textures mazeTextures_;
     Observers mazeObservers_;
+    vector<vector<Observer*>> tileObservers_;   // the observers notified when each type of tile is activated, indexed by TileType
     sf::Vector2f topLeftPos_;
     float tileLength_;
     float width_;
     float height_;
     sf::Vector2f offset_;
 
-    vector<vector<tilePtr>> maze_;         // NOTE: maze_[x][y] == maze[col][row]
-    vector<tuple<int,int>> keyPos_;
-    map<tuple<int,int>, vector<tilePtr>> keyMap_;
+    // Tile records, indexed by row*numCols_ + col
+    int numRows_ = 0;
+    int numCols_ = 0;
+    vector<TileRecord> tiles_;
+    vector<vector<int>> keyGates_;      // payload for keys: the indices of the gates each key opens
+    MazeRenderer renderer_;
+
+    int foodCount_ = 0;
+    bool gatesArePassable_ = false;
+
+    // Distances from each target tile (indexed like tiles_), see getPathLength()
+    map<int,vector<int>> fixedFields_;
+    int sharedTarget_ = -1;
+    vector<int> sharedField_;
+    list<pair<int,vector<int>>> recentFields_;     // the most recently used first
 
-    static int foodCount_;
+    static const unsigned char NODE = 1;
+    static const unsigned char BROKEN = 2;
+    static const size_t MAX_RECENT_FIELDS = 64;
 
     // Private member functions
-    void updateTile(Maze::tilePtr& tile);
     void createMaze();
-    tilePtr assignTile(int row, int col);
-    float char2Angle(char c) const;
+    void createRenderer();
+    void createObservers();
+    int getTextureIndex(const TileRecord& tile) const;
+    TileRecord assignTile(int row, int col);
     void applyKeyMap(posKeyMap keyMap);
+    void openTile(int index);
+    void updateNeighbours(int index);
+    void createDistanceFields();
+    const vector<int>& getDistanceField(int targetIndex);
+    void findDistances(int targetIndex, vector<int>& distances) const;
+    int getTargetIndex(sf::Vector2f target) const;
+    int getWrappedNode(int index, sf::Vector2f direction) const;
+    int getNearestNode(int index) const;
+    void notify(const vector<Observer*>& observers, Observer::Event event) const;
+    int getIndex(sf::Vector2f position) const;
+    sf::Vector2f getPosition(int index) const;
+    unsigned char char2Rotation(char c) const;
+    unsigned char dir2Mask(sf::Vector2f direction) const;
 };
 #endif
@@ -22,10 +22,10 @@ void MazeEditorHelp::processInput()
 {
     sf::Event event;
 
-    while (game_->window.pollEvent(event))
+    while (game_->inputManager.pollEvent(game_->window, event))
     {
         if (game_->inputManager.isExitRequest(event))
-            game_->window.close();
+            game_->closeWindow();
         
         if (event.type == sf::Event::Resized)
             game_->view = game_->inputManager.getLetterboxView(game_->view, event.size.width, event.size.height);
@@ -34,7 +34,7 @@ void MazeEditorHelp::processInput()
         {
             if (exitButton_.isHover(game_->window))
             {
-                game_->assetManager.playSound("button click");
+                game_->assetManager.playSound(Sound::BUTTON_CLICK);
                 game_->stateMachine.addState(make_unique<LevelEditorState>(game_));
             }
             
@@ -221,6 +221,38 @@ void MazeEditorHelp::loadText(AssetManager& assetManager)
     }
     
     pages_.push_back(paragraph);
+
+    paragraph.clear();
+
+    line.setString("- To make a larger or smaller maze, hold SHIFT and press\n");
+    paragraph.push_back(line);
+
+    line.setString("  the RIGHT or DOWN arrow key to add a column or row, or\n");
+    paragraph.push_back(line);
+
+    line.setString("  the LEFT or UP arrow key to remove one. Tiles in a row\n");
+    paragraph.push_back(line);
+
+    line.setString("  or column that is removed are erased\n");
+    paragraph.push_back(line);
+
+    line.setString("- When the maze is too large to fit on the screen, use the\n");
+    paragraph.push_back(line);
+
+    line.setString("  arrow keys to scroll around the grid. The numbers beside\n");
+    paragraph.push_back(line);
+
+    line.setString("  the grid show which rows and columns are in view\n");
+    paragraph.push_back(line);
+
+    for (int i = 0; i< paragraph.size(); i++)
+    {
+        paragraph[i].setScale(0.7,0.7);
+        paragraph[i].setOrigin(0.f, paragraph[i].getGlobalBounds().height/2);
+        paragraph[i].setPosition(25 ,125.f + i*40.f);
+    }
+
+    pages_.push_back(paragraph);
 }
 
 void MazeEditorHelp::loadButtons(AssetManager& assetManager)
@@ -254,11 +286,11 @@ void MazeEditorHelp::nextPage()
 {
     if (pageNum_ == pages_.size() - 1)
     {
-        game_->assetManager.playSound("error");
+        game_->assetManager.playSound(Sound::BUTTON_ERROR);
     }
     else
     {
-        game_->assetManager.playSound("button click");
+        game_->assetManager.playSound(Sound::BUTTON_CLICK);
         
         pageNum_++;
         pageDisplay_.setString(to_string(pageNum_ + 1) + "/" + to_string(pages_.size()));
@@ -270,11 +302,11 @@ void MazeEditorHelp::previousPage()
 {
     if (pageNum_ == 0)
     {
-        game_->assetManager.playSound("error");
+        game_->assetManager.playSound(Sound::BUTTON_ERROR);
     }
     else
     {
-        game_->assetManager.playSound("button click");
+        game_->assetManager.playSound(Sound::BUTTON_CLICK);
         
         pageNum_--;
         pageDisplay_.setString(to_string(pageNum_ + 1) + "/" + to_string(pages_.size()));
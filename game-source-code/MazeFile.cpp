@@ -0,0 +1,363 @@
+#include "MazeFile.h"
+
+#include "Configuration.h"
+
+#include <cstdio>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // The index of each layout key is stored in the low four bits of a tile, and its rotation in the next two
+    const auto LAYOUT_KEYS = string{"EWCGKFPS"};
+    const auto ROTATION_SHIFT = 4;
+
+    static_assert(sizeof(float) == 4, "Maze files store start positions as 32 bit floats");
+}
+
+MazeFile::~MazeFile()
+{
+    close();
+}
+
+bool MazeFile::open(const string& filePath)
+{
+    close();
+
+    if (!file_.open(filePath))
+        return false;
+
+    if (!validate())
+    {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void MazeFile::close()
+{
+    file_.close();
+
+    header_ = Header{};
+    tiles_ = keys_ = gates_ = starts_ = nullptr;
+}
+
+int MazeFile::getNumRows() const
+{
+    return header_.numRows;
+}
+
+int MazeFile::getNumCols() const
+{
+    return header_.numCols;
+}
+
+char MazeFile::getLayoutKey(int row, int col) const
+{
+    return LAYOUT_KEYS[tiles_[row*header_.numCols + col] & 0x0F];
+}
+
+char MazeFile::getRotationKey(int row, int col) const
+{
+    return static_cast<char>('0' + (tiles_[row*header_.numCols + col] >> ROTATION_SHIFT));
+}
+
+Maze::Data MazeFile::getData() const
+{
+    auto data = Maze::Data{};
+
+    if (!isOpen())
+        return data;
+
+    auto row = string(header_.numCols, ' ');
+    auto rotations = string(header_.numCols, ' ');
+
+    for (auto r = 0; r < header_.numRows; r++)
+    {
+        for (auto c = 0; c < header_.numCols; c++)
+        {
+            row[c] = getLayoutKey(r, c);
+            rotations[c] = getRotationKey(r, c);
+        }
+
+        data.layout.push_back(row);
+        data.rotationMap.push_back(rotations);
+    }
+
+    for (auto i = 0u; i < header_.numKeys; i++)
+    {
+        Key key;
+        memcpy(&key, keys_ + i*sizeof(Key), sizeof(Key));
+
+        auto gates = vector<tuple<int,int>>{};
+        for (auto j = key.firstGate; j < key.firstGate + key.numGates; j++)
+        {
+            Gate gate;
+            memcpy(&gate, gates_ + j*sizeof(Gate), sizeof(Gate));
+            gates.push_back(make_tuple(gate.x, gate.y));
+        }
+
+        data.keyMap.insert({make_tuple(key.x, key.y), gates});
+    }
+
+    for (auto i = 0; i < header_.numStarts; i++)
+    {
+        float position[2];
+        memcpy(position, starts_ + i*sizeof(position), sizeof(position));
+        data.startPos.push_back(sf::Vector2f{position[0], position[1]});
+    }
+
+    return data;
+}
+
+bool MazeFile::write(const Maze::Data& data, const string& filePath)
+{
+    auto numRows = data.layout.size();
+    auto numCols = numRows > 0 ? data.layout[0].size() : 0;
+
+    if (numRows == 0 || numCols == 0 || numRows > UINT16_MAX || numCols > UINT16_MAX || data.rotationMap.size() != numRows)
+        return false;
+
+    // Tiles
+    auto body = vector<unsigned char>(getTilesSize(numRows, numCols), 0);
+
+    for (auto r = 0u; r < numRows; r++)
+    {
+        if (data.layout[r].size() != numCols || data.rotationMap[r].size() != numCols)
+            return false;
+
+        for (auto c = 0u; c < numCols; c++)
+        {
+            auto type = LAYOUT_KEYS.find(data.layout[r][c]);
+            auto rotation = data.rotationMap[r][c] - '0';
+
+            if (type == string::npos || rotation < 0 || rotation > 3)
+                return false;
+
+            body[r*numCols + c] = static_cast<unsigned char>(type | (rotation << ROTATION_SHIFT));
+        }
+    }
+
+    auto append = [&body](const void* value, size_t size)
+    {
+        auto bytes = static_cast<const unsigned char*>(value);
+        body.insert(body.end(), bytes, bytes + size);
+    };
+
+    // Keys, followed by all of their gates
+    auto gates = vector<Gate>{};
+
+    for (auto& [keyPos, gatePos] : data.keyMap)
+    {
+        auto key = Key{static_cast<int16_t>(get<0>(keyPos)), static_cast<int16_t>(get<1>(keyPos)),
+                       static_cast<uint16_t>(gates.size()), static_cast<uint16_t>(gatePos.size())};
+        append(&key, sizeof(key));
+
+        for (auto& pos : gatePos)
+            gates.push_back(Gate{static_cast<int16_t>(get<0>(pos)), static_cast<int16_t>(get<1>(pos))});
+    }
+
+    if (gates.size() > UINT16_MAX)
+        return false;
+
+    for (auto& gate : gates)
+        append(&gate, sizeof(gate));
+
+    // Start positions
+    for (auto& start : data.startPos)
+    {
+        float position[2] = {start.x, start.y};
+        append(position, sizeof(position));
+    }
+
+    auto header = Header{};
+    memcpy(header.tag, MAZE_FILE_TAG, sizeof(header.tag));
+    header.version = MAZE_FILE_VERSION;
+    header.numRows = numRows;
+    header.numCols = numCols;
+    header.numStarts = data.startPos.size();
+    header.numKeys = data.keyMap.size();
+    header.numGates = gates.size();
+    header.size = body.size();
+    header.checksum = getChecksum(body.data(), body.size());
+
+    // The file is written beside the old one and then moved over it, so that a game which has the old one mapped (e.g. on another thread) never sees it half written
+    auto tempPath = filePath + "." + to_string(hash<thread::id>{}(this_thread::get_id())) + ".tmp";
+
+    ofstream file{tempPath, ofstream::out | ofstream::binary | ofstream::trunc};
+
+    if (!file)
+        return false;
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(body.data()), body.size());
+    file.close();
+
+    auto isWritten = static_cast<bool>(file);
+
+    if (isWritten && rename(tempPath.c_str(), filePath.c_str()) != 0)
+    {
+        // Some platforms will not rename over an existing file
+        remove(filePath.c_str());
+        isWritten = rename(tempPath.c_str(), filePath.c_str()) == 0;
+    }
+
+    if (!isWritten)
+        remove(tempPath.c_str());
+
+    return isWritten;
+}
+
+bool MazeFile::isUpToDate(const string& mazeName)
+{
+    auto error = error_code{};
+    auto written = filesystem::last_write_time(MAZE_DIRECTORY + mazeName + MAZE_FILE_EXTENSION, error);
+
+    if (error)
+        return false;
+
+    // Text files that are missing are ignored, as they are when the maze is imported
+    for (auto& sourcePath : getSourcePaths(mazeName))
+    {
+        auto modified = filesystem::last_write_time(sourcePath, error);
+
+        if (!error && modified > written)
+            return false;
+    }
+
+    return true;
+}
+
+filesystem::file_time_type MazeFile::getModifiedTime(const string& mazeName)
+{
+    auto paths = getSourcePaths(mazeName);
+    paths.push_back(MAZE_DIRECTORY + mazeName + MAZE_FILE_EXTENSION);
+
+    auto latest = filesystem::file_time_type::min();
+
+    for (auto& path : paths)
+    {
+        auto error = error_code{};
+        auto modified = filesystem::last_write_time(path, error);
+
+        if (!error)
+            latest = max(latest, modified);
+    }
+
+    return latest;
+}
+
+/*------------- Private helper functions -------------*/
+
+bool MazeFile::validate()
+{
+    static_assert(sizeof(Header) == 32, "The maze file header must not be padded");
+
+    auto data = file_.getData();
+    auto size = file_.getSize();
+
+    if (size < sizeof(Header))
+        return false;
+
+    memcpy(&header_, data, sizeof(Header));
+
+    if (memcmp(header_.tag, MAZE_FILE_TAG, sizeof(header_.tag)) != 0 || header_.version != MAZE_FILE_VERSION)
+        return false;
+
+    if (header_.size != size - sizeof(Header) || header_.numRows == 0 || header_.numCols == 0)
+        return false;
+
+    auto tilesSize = getTilesSize(header_.numRows, header_.numCols);
+    auto keysSize = static_cast<size_t>(header_.numKeys)*sizeof(Key);
+    auto gatesSize = static_cast<size_t>(header_.numGates)*sizeof(Gate);
+    auto startsSize = static_cast<size_t>(header_.numStarts)*2*sizeof(float);
+
+    if (tilesSize + keysSize + gatesSize + startsSize != header_.size)
+        return false;
+
+    if (getChecksum(data + sizeof(Header), header_.size) != header_.checksum)
+        return false;
+
+    tiles_ = data + sizeof(Header);
+    keys_ = tiles_ + tilesSize;
+    gates_ = keys_ + keysSize;
+    starts_ = gates_ + gatesSize;
+
+    // Check the contents that would otherwise be read out of bounds
+    for (auto i = 0; i < header_.numRows*header_.numCols; i++)
+    {
+        if ((tiles_[i] & 0x0F) >= LAYOUT_KEYS.size() || (tiles_[i] >> ROTATION_SHIFT) > 3)
+            return false;
+    }
+
+    for (auto i = 0u; i < header_.numKeys; i++)
+    {
+        Key key;
+        memcpy(&key, keys_ + i*sizeof(Key), sizeof(Key));
+
+        if (key.firstGate + key.numGates > header_.numGates || !isInside(key.x, key.y))
+            return false;
+    }
+
+    for (auto i = 0u; i < header_.numGates; i++)
+    {
+        Gate gate;
+        memcpy(&gate, gates_ + i*sizeof(Gate), sizeof(Gate));
+
+        if (!isInside(gate.x, gate.y))
+            return false;
+    }
+
+    for (auto i = 0; i < header_.numStarts; i++)
+    {
+        float position[2];
+        memcpy(position, starts_ + i*sizeof(position), sizeof(position));
+
+        if (!isfinite(position[0]) || !isfinite(position[1]) || position[0] < 0 || position[1] < 0 ||
+            position[0] >= header_.numCols || position[1] >= header_.numRows)
+            return false;
+    }
+
+    return true;
+}
+
+bool MazeFile::isInside(int col, int row) const
+{
+    return col >= 0 && col < header_.numCols && row >= 0 && row < header_.numRows;
+}
+
+uint32_t MazeFile::getChecksum(const unsigned char* bytes, size_t size)
+{
+    auto hash = uint32_t{2166136261u};
+
+    for (auto i = size_t{0}; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+size_t MazeFile::getTilesSize(int numRows, int numCols)
+{
+    // Padded so that the sections after the tiles stay aligned
+    return (static_cast<size_t>(numRows)*numCols + 3) & ~size_t{3};
+}
+
+vector<string> MazeFile::getSourcePaths(const string& mazeName)
+{
+    auto paths = vector<string>{};
+
+    for (auto suffix : {"_layout.txt", "_orientations.txt", "_keymap.txt", "_startpositions.txt"})
+        paths.push_back(MAZE_DIRECTORY + mazeName + suffix);
+
+    return paths;
+}
@@ -0,0 +1,136 @@
+#ifndef MAZE_FILE_H
+#define MAZE_FILE_H
+
+/// \file MazeFile.h
+/// \brief Contains the class definition for the "MazeFile" class
+
+#include "Maze.h"
+#include "MappedFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/// \class MazeFile
+/// \brief A maze stored in a single binary file, which is mapped into memory rather than read and parsed
+///
+/// The four text files of a maze (its layout, rotations, key map and start positions) are packed into one file. This starts with a fixed-size header giving the version and the size of each section, followed by one byte for each tile (its layout key and rotation), the table of keys and the gates each one opens, and the start positions. The header ends with a checksum of everything after it, so a file that was cut short or damaged is rejected and the maze can be imported from its text files again.
+///
+/// Opening a file maps it into memory, so the tiles are read straight out of the file's pages without being copied, and no memory is allocated until getData() is called. Numbers are stored in little-endian order.
+
+class MazeFile
+{
+public:
+    /// Default constructor
+    MazeFile() {}
+
+    /// Destructor, which unmaps the file
+    ~MazeFile();
+
+    MazeFile(const MazeFile&) = delete;
+    MazeFile& operator=(const MazeFile&) = delete;
+
+    /// Map a maze file into memory and check that it is valid
+    /// @param filePath the path of the file
+    /// \return true if the file was opened and is a valid maze file of this version, and false otherwise
+    bool open(const string& filePath);
+
+    /// Unmap the file, if one is open
+    void close();
+
+    /// Check whether a valid file is open
+    /// \return true if a file is open, and false otherwise
+    bool isOpen() const {return file_.isOpen();}
+
+    /// Get the number of rows of tiles
+    /// \return the number of rows
+    int getNumRows() const;
+
+    /// Get the number of columns of tiles
+    /// \return the number of columns
+    int getNumCols() const;
+
+    /// Get the layout key of a tile, as it appears in the layout text file
+    /// @param row the row of the tile
+    /// @param col the column of the tile
+    /// \return the layout key (E, W, C, G, K, F, P or S)
+    char getLayoutKey(int row, int col) const;
+
+    /// Get the rotation key of a tile, as it appears in the rotation text file
+    /// @param row the row of the tile
+    /// @param col the column of the tile
+    /// \return the rotation key ('0' to '3')
+    char getRotationKey(int row, int col) const;
+
+    /// Unpack the whole maze, e.g. to construct a Maze from it
+    /// \return the maze's layout, rotation map, key map and start positions
+    Maze::Data getData() const;
+
+    /// Pack a maze into a binary file
+    /// @param data the maze's layout, rotation map, key map and start positions
+    /// @param filePath the path of the file
+    /// \return true if the file was written, and false if it could not be, or the maze's rows are not all the same length
+    static bool write(const Maze::Data& data, const string& filePath);
+
+    /// Check whether a maze's binary file was written after its text files were last changed, e.g. by hand
+    /// @param mazeName the name of the maze, whose files are in MAZE_DIRECTORY
+    /// \return true if the binary file exists and is at least as new as each of the text files, and false otherwise
+    static bool isUpToDate(const string& mazeName);
+
+    /// Get the last time that any of a maze's files changed
+    /// @param mazeName the name of the maze, whose files are in MAZE_DIRECTORY
+    /// \return the latest modification time of the binary file and the text files, or file_time_type::min() if none of them exist
+    static filesystem::file_time_type getModifiedTime(const string& mazeName);
+
+private:
+    /// \struct The start of every maze file
+    struct Header
+    {
+        char tag[4];
+        uint16_t version;
+        uint16_t numRows;
+        uint16_t numCols;
+        uint16_t numStarts;
+        uint32_t numKeys;
+        uint32_t numGates;
+        uint32_t size;          // the number of bytes after the header
+        uint32_t checksum;      // FNV-1a hash of the bytes after the header
+        uint32_t reserved;
+    };
+
+    /// \struct A key and the range of the gates that it opens
+    struct Key
+    {
+        int16_t x;
+        int16_t y;
+        uint16_t firstGate;
+        uint16_t numGates;
+    };
+
+    /// \struct The position of a gate
+    struct Gate
+    {
+        int16_t x;
+        int16_t y;
+    };
+
+    MappedFile file_;
+    Header header_{};
+    const unsigned char* tiles_ = nullptr;
+    const unsigned char* keys_ = nullptr;
+    const unsigned char* gates_ = nullptr;
+    const unsigned char* starts_ = nullptr;
+
+    // Private helper functions
+    bool validate();
+    bool isInside(int col, int row) const;
+    static uint32_t getChecksum(const unsigned char* bytes, size_t size);
+    static size_t getTilesSize(int numRows, int numCols);
+    static vector<string> getSourcePaths(const string& mazeName);
+};
+
+#endif
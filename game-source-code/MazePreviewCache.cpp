@@ -0,0 +1,74 @@
+#include "MazePreviewCache.h"
+#include "MazeFile.h"
+
+#include <algorithm>
+
+MazePreviewCache::MazePreviewCache(int capacity): capacity_{max(capacity, 1)}
+{}
+
+const sf::Texture* MazePreviewCache::find(const string& mazeName)
+{
+    auto preview = findPreview(mazeName);
+
+    if (preview == previews_.end() || preview->modified != MazeFile::getModifiedTime(mazeName))
+        return nullptr;
+
+    preview->lastUsed = ++useCount_;
+    return &preview->texture->getTexture();
+}
+
+const sf::Texture* MazePreviewCache::add(const string& mazeName, sf::Vector2u size, const drawFunction& draw)
+{
+    auto preview = findPreview(mazeName);
+
+    if (preview == previews_.end())
+    {
+        if (previews_.size() < static_cast<size_t>(capacity_))
+        {
+            previews_.emplace_back();
+            preview = previews_.end() - 1;
+        }
+        else
+        {
+            preview = min_element(previews_.begin(), previews_.end(), [](auto& a, auto& b){return a.lastUsed < b.lastUsed;});
+        }
+
+        preview->mazeName = mazeName;
+    }
+
+    // A texture of the right size is drawn over rather than being created again
+    if (!preview->texture || preview->texture->getSize() != size)
+    {
+        preview->texture = make_unique<sf::RenderTexture>();
+
+        if (!preview->texture->create(size.x, size.y))
+        {
+            previews_.erase(preview);
+            return nullptr;
+        }
+    }
+
+    preview->texture->clear(sf::Color::Transparent);
+    draw(*preview->texture);
+    preview->texture->display();
+
+    preview->modified = MazeFile::getModifiedTime(mazeName);
+    preview->lastUsed = ++useCount_;
+
+    return &preview->texture->getTexture();
+}
+
+void MazePreviewCache::remove(const string& mazeName)
+{
+    auto preview = findPreview(mazeName);
+
+    if (preview != previews_.end())
+        previews_.erase(preview);
+}
+
+/*------------- Private helper functions -------------*/
+
+vector<MazePreviewCache::Preview>::iterator MazePreviewCache::findPreview(const string& mazeName)
+{
+    return find_if(previews_.begin(), previews_.end(), [&mazeName](auto& preview){return preview.mazeName == mazeName;});
+}
@@ -0,0 +1,73 @@
+#ifndef MAZE_PREVIEW_CACHE_H
+#define MAZE_PREVIEW_CACHE_H
+
+/// \file MazePreviewCache.h
+/// \brief Contains the class definition for the "MazePreviewCache" class
+
+#include <SFML/Graphics.hpp>
+
+#include "Configuration.h"
+
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/// \class MazePreviewCache
+/// \brief Keeps the previews of the most recently viewed mazes, each rendered once into its own texture
+///
+/// A preview is found by the maze's name and the last time any of its files changed (see MazeFile::getModifiedTime), so a maze which is edited or deleted and recreated in the level editor is rendered again rather than shown out of date. When the cache is full, the preview that has gone unused for the longest is replaced.
+///
+/// The cache belongs to the Game, so the previews outlive the maze select screen. The textures must only be rendered on the thread that owns the window's OpenGL context.
+
+class MazePreviewCache
+{
+public:
+    typedef function<void(sf::RenderTarget&)> drawFunction; /**\typedef for a function drawing a maze onto a preview, to improve readability */
+
+    /// Constructor
+    /// @param capacity the maximum number of previews kept
+    MazePreviewCache(int capacity = MAZE_PREVIEW_CACHE_SIZE);
+
+    /// Find the preview of a maze, if it is still up to date
+    /// @param mazeName the name of the maze
+    /// \return a pointer to the preview's texture, or nullptr if the maze has not been rendered since its file last changed
+    const sf::Texture* find(const string& mazeName);
+
+    /// Render the preview of a maze, replacing any older preview of it
+    /// @param mazeName the name of the maze
+    /// @param size the size of the preview in pixels
+    /// @param draw a function drawing the maze onto the preview, whose top left corner is at the origin
+    /// \return a pointer to the preview's texture, or nullptr if a texture of that size could not be created
+    const sf::Texture* add(const string& mazeName, sf::Vector2u size, const drawFunction& draw);
+
+    /// Forget the preview of a maze
+    /// @param mazeName the name of the maze
+    void remove(const string& mazeName);
+
+    /// Get the number of previews kept
+    /// \return the number of previews in the cache
+    int getNumPreviews() const {return previews_.size();}
+
+private:
+    /// \struct A rendered maze along with what it was rendered from
+    struct Preview
+    {
+        string mazeName;
+        filesystem::file_time_type modified;
+        unique_ptr<sf::RenderTexture> texture;
+        int lastUsed = 0;
+    };
+
+    vector<Preview> previews_;
+    int capacity_;
+    int useCount_ = 0;      // incremented each time a preview is used, to find the least recently used one
+
+    // Private helper functions
+    vector<Preview>::iterator findPreview(const string& mazeName);
+};
+
+#endif
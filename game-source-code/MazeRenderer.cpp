@@ -0,0 +1,170 @@
+#include "MazeRenderer.h"
+
+#include <algorithm>
+
+MazeRenderer::MazeRenderer(vector<texturePtr> textures, int numRows, int numCols, int chunkSize):
+    numCols_{numCols},
+    chunkSize_{max(chunkSize, 1)},
+    quads_{make_shared<vector<Quad>>(numRows*numCols)}
+{
+    createAtlas(textures);
+
+    numChunkCols_ = (numCols + chunkSize_ - 1) / chunkSize_;
+    auto numChunkRows = (numRows + chunkSize_ - 1) / chunkSize_;
+
+    for (auto chunk = 0; chunk < numChunkRows*numChunkCols_; chunk++)
+        chunks_.push_back(make_shared<Chunk>());
+}
+
+void MazeRenderer::addTile(int index, sf::Vector2f position, int textureIndex, unsigned char rotation, bool isUpper)
+{
+    auto& quad = (*quads_)[index];
+    auto row = index / numCols_;
+    auto col = index % numCols_;
+
+    quad.chunk = (row / chunkSize_) * numChunkCols_ + col / chunkSize_;
+    quad.isUpper = isUpper;
+    quad.position = position;
+    quad.rotation = rotation;
+
+    auto& chunk = *chunks_[quad.chunk];
+    auto& vertices = isUpper ? chunk.upper : chunk.lower;
+    quad.offset = vertices.getVertexCount();
+    vertices.resize(vertices.getVertexCount() + 4);
+    setQuad(chunk, quad, textureIndex);
+
+    // Grow the chunk's bounds to cover the new quad
+    auto isFirstQuad = (chunk.lower.getVertexCount() + chunk.upper.getVertexCount() == 4);
+    auto topLeft = isFirstQuad ? vertices[quad.offset].position : sf::Vector2f{chunk.bounds.left, chunk.bounds.top};
+    auto bottomRight = isFirstQuad ? topLeft : topLeft + sf::Vector2f{chunk.bounds.width, chunk.bounds.height};
+
+    for (auto corner = 0; corner < 4; corner++)
+    {
+        auto point = vertices[quad.offset + corner].position;
+        topLeft = sf::Vector2f{min(topLeft.x, point.x), min(topLeft.y, point.y)};
+        bottomRight = sf::Vector2f{max(bottomRight.x, point.x), max(bottomRight.y, point.y)};
+    }
+
+    chunk.bounds = sf::FloatRect{topLeft, bottomRight - topLeft};
+}
+
+void MazeRenderer::updateTile(int index, int textureIndex)
+{
+    const auto& quad = (*quads_)[index];
+    if (quad.offset < 0)
+        return;
+
+    setQuad(getUniqueChunk(quad.chunk), quad, textureIndex);
+    revision_++;
+}
+
+int MazeRenderer::getNumVisibleChunks(sf::FloatRect area) const
+{
+    return count_if(chunks_.begin(), chunks_.end(), [&](auto& chunk){return chunk->bounds.intersects(area);});
+}
+
+void MazeRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    if (!atlas_)
+        return;
+
+    states.texture = atlas_.get();
+
+    const auto& view = target.getView();
+    auto viewArea = sf::FloatRect{view.getCenter() - view.getSize()/2.f, view.getSize()};
+
+    // Every lower layer is drawn before any upper layer, as walls can overhang neighbouring chunks
+    for (auto& chunk : chunks_)
+    {
+        if (states.transform.transformRect(chunk->bounds).intersects(viewArea))
+            target.draw(chunk->lower, states);
+    }
+
+    for (auto& chunk : chunks_)
+    {
+        if (states.transform.transformRect(chunk->bounds).intersects(viewArea))
+            target.draw(chunk->upper, states);
+    }
+}
+
+/*------------- Private helper functions -------------*/
+
+void MazeRenderer::createAtlas(vector<texturePtr>& textures)
+{
+    const auto padding = 1u;
+    auto width = 0u;
+    auto height = 0u;
+
+    for (auto& texture : textures)
+    {
+        if (!texture)
+            continue;
+
+        width += texture->getSize().x + padding;
+        height = max(height, texture->getSize().y);
+    }
+
+    textureRects_.clear();
+
+    if (width == 0 || height == 0)
+    {
+        textureRects_.resize(textures.size());
+        return;
+    }
+
+    auto image = sf::Image{};
+    image.create(width, height, sf::Color::Transparent);
+
+    auto left = 0u;
+
+    for (auto& texture : textures)
+    {
+        if (!texture)
+        {
+            textureRects_.push_back(sf::IntRect{});
+            continue;
+        }
+
+        auto size = texture->getSize();
+        image.copy(texture->copyToImage(), left, 0);
+        textureRects_.push_back(sf::IntRect(left, 0, size.x, size.y));
+        left += size.x + padding;
+    }
+
+    atlas_ = make_shared<sf::Texture>();
+    atlas_->loadFromImage(image);
+}
+
+MazeRenderer::Chunk& MazeRenderer::getUniqueChunk(int chunk)
+{
+    // Copy on write, so that copies of the renderer keep their own version of the chunk
+    if (chunks_[chunk].use_count() > 1)
+        chunks_[chunk] = make_shared<Chunk>(*chunks_[chunk]);
+
+    return *chunks_[chunk];
+}
+
+void MazeRenderer::setQuad(Chunk& chunk, const Quad& quad, int textureIndex)
+{
+    auto& vertices = quad.isUpper ? chunk.upper : chunk.lower;
+    auto rect = textureRects_[textureIndex];
+
+    // Corners of the texture, clockwise from the top left
+    sf::Vector2f texCoords[4] = {sf::Vector2f(rect.left, rect.top),
+                                 sf::Vector2f(rect.left + rect.width, rect.top),
+                                 sf::Vector2f(rect.left + rect.width, rect.top + rect.height),
+                                 sf::Vector2f(rect.left, rect.top + rect.height)};
+
+    for (auto corner = 0; corner < 4; corner++)
+    {
+        // Centre the texture on the tile and rotate it clockwise in quarter turns (as sf::Sprite::setRotation would)
+        auto point = texCoords[corner] - sf::Vector2f(rect.left + rect.width/2.f, rect.top + rect.height/2.f);
+
+        for (auto turn = 0; turn < quad.rotation; turn++)
+            point = sf::Vector2f{-point.y, point.x};
+
+        auto& vertex = vertices[quad.offset + corner];
+        vertex.position = quad.position + point;
+        vertex.texCoords = texCoords[corner];
+    }
+}
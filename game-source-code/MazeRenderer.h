@@ -0,0 +1,102 @@
+#ifndef MAZE_RENDERER_H
+#define MAZE_RENDERER_H
+
+/// \file MazeRenderer.h
+/// \brief Contains the class definition for the "MazeRenderer" class
+
+#include <SFML/Graphics.hpp>
+
+#include "Configuration.h"
+
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+/// \class MazeRenderer
+/// \brief An object that draws the tiles of the maze using a single texture atlas and a few vertex arrays
+///
+/// The textures of all the tile types are packed side by side into one atlas when the renderer is created. Each tile is then represented by a single quad in one of two vertex arrays: the lower layer (floor, gates, keys and food) and the upper layer (walls and corners), which is drawn last so that the maze appears visually correct. Only the quad of a tile that changes appearance is updated.
+///
+/// The tiles are split into square chunks of MAZE_CHUNK_SIZE tiles a side, each with its own pair of vertex arrays, and only the chunks that overlap the target's view are drawn. A small maze is drawn with a handful of draw calls, while the cost of drawing a large one depends on the size of the view rather than the maze. Copies of the renderer share their chunks until a tile changes, when only that tile's chunk is copied.
+
+class MazeRenderer : public sf::Drawable
+{
+public:
+    typedef shared_ptr<sf::Texture> texturePtr; /**\typedef for a pointer to a sf::Texture, to improve readability */
+
+    /// Default constructor
+    MazeRenderer() {}
+
+    /// Constructor
+    ///
+    /// Packs the given textures into the atlas. A tile's texture is later referred to by its index in this vector
+    /// @param textures a vector of shared pointers to the textures of each tile type
+    /// @param numRows the number of rows of tiles in the maze
+    /// @param numCols the number of columns of tiles in the maze
+    /// @param chunkSize the number of tiles along each side of a chunk
+    MazeRenderer(vector<texturePtr> textures, int numRows, int numCols, int chunkSize = MAZE_CHUNK_SIZE);
+
+    /// Add a tile to the maze
+    /// @param index the index of the tile in the maze (row*numCols + col)
+    /// @param position the coordinates of the centre of the tile in the form sf::Vector2f{x,y}
+    /// @param textureIndex the index of the tile's texture in the atlas
+    /// @param rotation the number of clockwise quarter turns of the tile
+    /// @param isUpper true if the tile should be drawn in the upper layer (walls and corners), and false otherwise
+    void addTile(int index, sf::Vector2f position, int textureIndex, unsigned char rotation, bool isUpper);
+
+    /// Change the texture of a tile that has already been added
+    /// @param index the index of the tile in the maze
+    /// @param textureIndex the index of the tile's new texture in the atlas
+    void updateTile(int index, int textureIndex);
+
+    /// Get the number of times a tile has changed appearance, so that copies of the renderer can tell when they are out of date
+    /// \return the revision of the vertex arrays
+    int getRevision() const {return revision_;}
+
+    /// Get the number of chunks that overlap an area
+    /// @param area the area in the maze's coordinates
+    /// \return the number of chunks that would be drawn if the area were in view
+    int getNumVisibleChunks(sf::FloatRect area) const;
+
+    /// Overriding of SFML's draw function to draw both layers of the chunks in view
+    /// @param target Render target to draw to
+    /// @param states Current render states
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+private:
+    /// \struct The location of a tile's quad within the vertex arrays, along with what is needed to rebuild it
+    struct Quad
+    {
+        int chunk = 0;
+        bool isUpper = false;
+        int offset = -1;
+        sf::Vector2f position;
+        unsigned char rotation = 0;
+    };
+
+    /// \struct Both layers of a square block of tiles, along with the area they cover
+    struct Chunk
+    {
+        sf::VertexArray lower{sf::Quads};
+        sf::VertexArray upper{sf::Quads};
+        sf::FloatRect bounds;
+    };
+
+    shared_ptr<sf::Texture> atlas_;
+    vector<sf::IntRect> textureRects_;
+
+    int numCols_ = 0;
+    int chunkSize_ = 1;
+    int numChunkCols_ = 0;
+    vector<shared_ptr<Chunk>> chunks_;      // shared with copies of the renderer until modified
+    shared_ptr<vector<Quad>> quads_;        // only written while tiles are being added
+    int revision_ = 0;
+
+    // Private helper functions
+    void createAtlas(vector<texturePtr>& textures);
+    Chunk& getUniqueChunk(int chunk);
+    void setQuad(Chunk& chunk, const Quad& quad, int textureIndex);
+};
+
+#endif
@@ -4,6 +4,7 @@
 #include "Soundboard.h"
 #include "Configuration.h"
 
+#include <algorithm>
 #include <iostream>
 
 MazeSelectState::MazeSelectState(gamePtr game): game_{game}
@@ -15,18 +16,19 @@ void MazeSelectState::initialise()
 {
     loadButtons(game_->assetManager);
     loadTitle(game_->assetManager);
-    loadMazes(game_->assetManager);
     loadCharacters(game_->assetManager);
+    loadBackground(game_->assetManager);
+    loadMazes(game_->assetManager);
 }
 
 void MazeSelectState::processInput()
 {
     sf::Event event;
 
-    while (game_->window.pollEvent(event))
+    while (game_->inputManager.pollEvent(game_->window, event))
     {
         if (game_->inputManager.isExitRequest(event))
-            game_->window.close();
+            game_->closeWindow();
         
         if (event.type == sf::Event::Resized)
             game_->view = game_->inputManager.getLetterboxView(game_->view, event.size.width, event.size.height);
@@ -35,7 +37,7 @@ void MazeSelectState::processInput()
         {
             if (exitButton_.isHover(game_->window))
             {
-                game_->assetManager.playSound("button click");
+                game_->assetManager.playSound(Sound::BUTTON_CLICK);
                 game_->stateMachine.addState(make_unique<MainMenuState>(game_));
             }
 
@@ -47,11 +49,12 @@ void MazeSelectState::processInput()
 
             if (playButton_.isHover(game_->window))
             {
-                game_->assetManager.stopSong("unravel");
-                game_->assetManager.playSound("button click");
+                game_->assetManager.stopSong(Song::UNRAVEL);
+                game_->assetManager.playSound(Sound::BUTTON_CLICK);
 
-                Soundboard::shufflePlaylist();
-                game_->assetManager.playSong(Soundboard::getPlaylist()[0]);
+                auto soundBoard = Soundboard{game_};
+                soundBoard.shufflePlaylist();
+                game_->assetManager.playSong(soundBoard.getPlaylist()[0]);
                 game_->stateMachine.addState(make_unique<IntermediateState>(game_, currentMaze_, 1));
             }
 
@@ -63,6 +66,8 @@ void MazeSelectState::processInput()
 
 void MazeSelectState::update(float dt)
 {
+    prepareNextMaze();
+
     exitButton_.update(game_->window);
 
     if (mazeIt != mazeNames_.begin() && mazeIt != mazeNames_.begin()+1)
@@ -105,13 +110,19 @@ void MazeSelectState::draw(float dt)
     game_->window.draw(playButton_);
     game_->window.draw(deleteButton_);
 
-    drawMaze();
+    game_->window.draw(preview_);
 
     game_->window.draw(mazeDisplayName_);
 
     game_->window.display();
 }
 
+float MazeSelectState::getIdleTimeout() const
+{
+    // Keep updating until the neighbouring previews are ready
+    return mazesToPrepare_.empty() ? IDLE_TIMEOUT : 0.f;
+}
+
 /*------------- Private helper functions -------------*/
 
 void MazeSelectState::loadButtons(AssetManager& assetManager)
@@ -170,10 +181,10 @@ void MazeSelectState::nextMaze()
     if (mazeIt+1 != mazeNames_.end())
     {
         mazeIt++;
-        game_->assetManager.playSound("button click");
+        game_->assetManager.playSound(Sound::BUTTON_CLICK);
     } else
     {
-        game_->assetManager.playSound("error");
+        game_->assetManager.playSound(Sound::BUTTON_ERROR);
         return;
     }
 
@@ -185,10 +196,10 @@ void MazeSelectState::previousMaze()
     if (mazeIt != mazeNames_.begin())
     {
         mazeIt--;
-        game_->assetManager.playSound("button click");
+        game_->assetManager.playSound(Sound::BUTTON_CLICK);
     } else
     {
-        game_->assetManager.playSound("error");
+        game_->assetManager.playSound(Sound::BUTTON_ERROR);
         return;
     }
 
@@ -199,14 +210,26 @@ void MazeSelectState::loadMazeData(AssetManager& assetManager)
 {
     currentMaze_ = *mazeIt;
 
-    assetManager.loadLayout("current layout", currentMaze_);
-    layout_ = assetManager.getLayout("current layout");
+    // The maze is only read if its preview has not been rendered since it last changed
+    auto texture = game_->mazePreviews.find(currentMaze_);
+
+    if (!texture)
+    {
+        assetManager.loadMaze("current maze", currentMaze_);
+        texture = renderPreview(currentMaze_, assetManager.getMaze("current maze"));
+    }
+
+    preview_ = texture ? sf::Sprite{*texture} : sf::Sprite{};
+    preview_.setPosition(getPreviewPosition());
 
-    assetManager.loadRotationMap("current rotation", currentMaze_);
-    rotationMap_ = assetManager.getRotationMap("current rotation");
+    // Render the mazes on either side while the player looks at this one, so that browsing to them is instant
+    mazesToPrepare_.clear();
 
-    assetManager.loadStartPos("current starts", currentMaze_);
-    startPos_ = assetManager.getStartPos("current starts");
+    if (mazeIt+1 != mazeNames_.end())
+        mazesToPrepare_.push_back(*(mazeIt+1));
+
+    if (mazeIt != mazeNames_.begin())
+        mazesToPrepare_.push_back(*(mazeIt-1));
 
     mazeDisplayName_.setString(currentMaze_);
     mazeDisplayName_.setOrigin(mazeDisplayName_.getGlobalBounds().width/2.0f, mazeDisplayName_.getGlobalBounds().height/2.0f);
@@ -239,50 +262,88 @@ void MazeSelectState::loadCharacters(AssetManager& assetManager)
     }
 }
 
-void MazeSelectState::drawMaze()
+void MazeSelectState::loadBackground(AssetManager& assetManager)
 {
-    auto& assetManager = game_->assetManager;
-
+    // A copy of the texture, so that it can be repeated without affecting the other states using it
     bgTexture_ = *assetManager.getTexture("grass");
     bgTexture_.setRepeated(true);
     background_.setTexture(bgTexture_);
     background_.setPosition(topLeft_);
     background_.setTextureRect(sf::IntRect(topLeft_.x, topLeft_.y, NUM_COLS*tileLength_ - 25, NUM_ROWS*tileLength_ - 25));
+}
 
-    game_->window.draw(background_);
+const sf::Texture* MazeSelectState::renderPreview(const string& mazeName, const Maze::Data& mazeData)
+{
+    auto numRows = max<int>(NUM_ROWS, mazeData.layout.size());
+    auto numCols = max<int>(NUM_COLS, mazeData.layout.empty() ? 0 : mazeData.layout[0].size());
+    auto size = sf::Vector2u(numCols*tileLength_, numRows*tileLength_);
+
+    return game_->mazePreviews.add(mazeName, size, [&](sf::RenderTarget& target)
+    {
+        // The maze is drawn where it appears on screen, moved so that the preview's corner is at the origin
+        auto states = sf::RenderStates{};
+        states.transform.translate(-getPreviewPosition());
+        drawMaze(target, states, mazeData);
+    });
+}
+
+void MazeSelectState::prepareNextMaze()
+{
+    if (mazesToPrepare_.empty())
+        return;
+
+    auto mazeName = mazesToPrepare_.back();
+    mazesToPrepare_.pop_back();
+
+    if (game_->mazePreviews.find(mazeName))
+        return;
+
+    game_->assetManager.loadMaze("preview maze", mazeName);
+    renderPreview(mazeName, game_->assetManager.getMaze("preview maze"));
+}
+
+sf::Vector2f MazeSelectState::getPreviewPosition() const
+{
+    // Tiles are centred on their positions, so the first row and column overhang the top left corner by half a tile
+    return topLeft_ - sf::Vector2f{tileLength_/2.f, tileLength_/2.f};
+}
+
+void MazeSelectState::drawMaze(sf::RenderTarget& target, sf::RenderStates states, const Maze::Data& mazeData)
+{
+    auto& layout = mazeData.layout;
+    auto& rotationMap = mazeData.rotationMap;
+
+    target.draw(background_, states);
 
     sf::Sprite tile;
 
     vector<sf::Sprite> walls;
 
-    for (auto row = 0; row < layout_.size(); row++)
+    for (auto row = 0; row < layout.size(); row++)
     {
-        for (auto col = 0; col < layout_[row].size(); col++)
+        for (auto col = 0; col < layout[row].size(); col++)
         {
-            tile = char2Sprite(layout_[row].at(col));
+            tile = char2Sprite(layout[row].at(col));
             tile.setPosition(topLeft_.x + col * tileLength_, topLeft_.y + row * tileLength_);
-            tile.setRotation(char2Angle(rotationMap_[row].at(col)));
+            tile.setRotation(char2Angle(rotationMap[row].at(col)));
 
-            if (layout_[row].at(col) == 'W' || layout_[row].at(col) == 'C')
+            if (layout[row].at(col) == 'W' || layout[row].at(col) == 'C')
                 walls.push_back(tile);
             else
-                game_->window.draw(tile);
+                target.draw(tile, states);
         }
     }
 
     // Draw walls last
     for (auto& wall : walls)
-        game_->window.draw(wall);
+        target.draw(wall, states);
 
     // Draw characters
-    characters_[0].setPosition(topLeft_ + tileLength_*startPos_[0]);
-    characters_[1].setPosition(topLeft_ + tileLength_*startPos_[1]);
-    characters_[2].setPosition(topLeft_ + tileLength_*startPos_[2]);
-    characters_[3].setPosition(topLeft_ + tileLength_*startPos_[3]);
-    characters_[4].setPosition(topLeft_ + tileLength_*startPos_[4]);
-
-    for (auto& character : characters_)
-        game_->window.draw(character);
+    for (auto i = 0u; i < characters_.size() && i < mazeData.startPos.size(); i++)
+    {
+        characters_[i].setPosition(topLeft_ + tileLength_*mazeData.startPos[i]);
+        target.draw(characters_[i], states);
+    }
 }
 
 
@@ -351,11 +412,12 @@ void MazeSelectState::deleteMaze()
 {
     if (mazeIt != mazeNames_.begin())
     {
+        game_->mazePreviews.remove(currentMaze_);
         game_->assetManager.deleteMazeData(currentMaze_);
 
         auto temp = mazeIt - mazeNames_.begin();
 
-        game_->assetManager.playSound("button click");
+        game_->assetManager.playSound(Sound::BUTTON_CLICK);
 
         game_->assetManager.loadMazeList();
         mazeNames_ = game_->assetManager.getMazeList();
@@ -369,5 +431,5 @@ void MazeSelectState::deleteMaze()
         return;
     }
 
-    game_->assetManager.playSound("error");
+    game_->assetManager.playSound(Sound::BUTTON_ERROR);
 }
@@ -19,6 +19,7 @@ public:
     void processInput() override;
     void update(float dt) override;
     void draw(float dt) override;
+    float getIdleTimeout() const override;
 
 private:
     gamePtr game_;
@@ -35,6 +36,7 @@ private:
     sf::Texture bgTexture_;
     sf::Sprite background_;
     vector<sf::Sprite> characters_;
+    sf::Sprite preview_;
 
     vector<string> mazeNames_;
     string currentMaze_;
@@ -42,18 +44,20 @@ private:
 
     sf::Text mazeDisplayName_;
     sf::Text title_;
-    
-    vector<string> layout_;
-    vector<string> rotationMap_;
-    vector<sf::Vector2f> startPos_;
+
+    vector<string> mazesToPrepare_;     // neighbouring mazes whose previews are rendered ahead of time, one per frame
 
     // Private helper functions
     void loadButtons(AssetManager& assetManager);
     void loadMazes(AssetManager& assetManager);
     void loadMazeData(AssetManager& assetManager);
     void loadCharacters(AssetManager& assetManager);
+    void loadBackground(AssetManager& assetManager);
 
-    void drawMaze();
+    const sf::Texture* renderPreview(const string& mazeName, const Maze::Data& mazeData);
+    void drawMaze(sf::RenderTarget& target, sf::RenderStates states, const Maze::Data& mazeData);
+    void prepareNextMaze();
+    sf::Vector2f getPreviewPosition() const;
     sf::Sprite char2Sprite(char c);
     float char2Angle(char c);
     
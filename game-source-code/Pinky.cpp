@@ -2,17 +2,6 @@
 #include <cmath>
 #include <iostream>
 
-#include "EnemyScatterState.h"
-
-void Pinky::update(float dt)
-{
-    if (char_states_.empty())
-        addCharState(std::make_shared<EnemyScatterState>(this, maze_));
-
-    updateCharState();
-    char_states_.top()->update(dt);
-}
-
 sf::Vector2f Pinky::getChaseTarget()
 {
     auto target = player_->getCurrentTile() + float{4*maze_->getTileLength()}*player_->currentDir();
@@ -25,28 +25,17 @@ class Pinky : public Enemy
          *
          *  Constructs an Enemy object and initialises the default direction to DOWN
          *
-         *  \param textures, a map<string,texturePtr> which maps a label to a texture pointer
+         *  \param clips, the animation clips of the enemy (which can be given as a map of textures)
          *  \param position, an sf::Vector2f which contains the x and y coordinates of the
          *      default and initial position of Pinky
          *  \param player, a pointer to the Player
          *  \param maze, a pointer to the Maze
          */
-        Pinky(map<string,texturePtr> textures, sf::Vector2f position, playerPtr player, mazePtr maze) :
-         Enemy(textures, position, player, maze)
+        Pinky(Clips clips, sf::Vector2f position, playerPtr player, mazePtr maze) :
+         Enemy(clips, position, player, maze)
          {current_dir_ = DOWN;
          default_dir_ = DOWN;}
 
-        /** \brief Handles Pinky's state changes, as well as calls on the current state to update
-         *
-         *  First any state changes are handled and updated using inherited functionality.
-         *  After this, the currrent state's update function is called, passing in the time
-         *  increment dt.
-         *
-         *  If the state stack is empty, a Scatter State is added to it
-         *
-         *  \param dt, the time increment since the last call to update
-         */
-        void update(float dt) override;
 
         /** \brief Returns the chase target for Pinky
          *
@@ -68,6 +57,9 @@ class Pinky : public Enemy
          */
         sf::Vector2f getScatterTarget() override;
 
+        /** \brief Returns "Pinky" */
+        const char* getName() const override {return "Pinky";}
+
     protected:
 
     private:
@@ -9,8 +9,9 @@
 #include <cmath>
 #include <iostream>
 
-Player::Player(map<string,texturePtr> textures, sf::Vector2f position, mazePtr maze):
-    Character(textures, position, maze),
+Player::Player(Clips clips, sf::Vector2f position, mazePtr maze):
+    Character(position, maze),
+    clips_(clips),
     numLives(NUMBER_OF_LIVES)
 {
     current_dir_ = RIGHT;
@@ -28,7 +29,7 @@ void Player::update(float dt)
 {
 
     if (char_states_.empty())
-        addCharState(std::make_shared<DefaultCharacterState>(this, maze_));
+        addCharState(getCharState<DefaultCharacterState>(this));
 
 
     timeEating_ += dt;
@@ -45,35 +46,14 @@ void Player::update(float dt)
 
 }
 
-void Player::animate(float dt, string textureKey)
+void Player::animate(float dt, Look look)
 {
-    auto tStep = 270;
-    int textureHeight = 40;
-    int textureWidth = 40;
-
-    if (textureKey == "dead")
-        textureWidth = 55;
-
-    if (isInteractive() && eatMode_)
-        textureKey = "kill " + textureKey;
-
-    animateTime+=dt;
-
-    auto& currentTexture_ = stateTextures[textureKey];
-    auto numFrames = static_cast<int>(currentTexture_->getSize().x/textureWidth);
-    auto frame = static_cast<int>((animateTime/tStep) * numFrames) % numFrames;
-
-    auto selectRect =  sf::IntRect(frame * textureWidth, 0, textureWidth, textureHeight);
-
-    sprite_.setTexture(*currentTexture_);
-    sprite_.setTextureRect(selectRect);
-
-    sprite_.setOrigin(sf::Vector2f{static_cast<float>(textureWidth/2), static_cast<float>(textureHeight/2)});
+    animator_.play(sprite_, clips_.get(look, isInteractive() && eatMode_), dt);
 
     if (super_mode)
-        sprite_.setScale(1.8,1.8);
+        animator_.setScale(sprite_, 1.8f);
     else
-        sprite_.setScale(1.25,1.25);
+        animator_.setScale(sprite_, 1.25f);
 }
 
 void Player::onNotify(Event event)
@@ -99,7 +79,7 @@ void Player::onNotify(Event event)
 void Player::enableSuperMode()
 {
     super_mode = true;
-    addCharState(std::make_shared<PlayerSuperState>(this, maze_));
+    addCharState(getCharState<PlayerSuperState>(this));
 }
 
 void Player::disableSuperMode()
@@ -135,11 +115,11 @@ void Player::Left()
 
 void Player::reset()
 {
-    char_states_ = {};
-    addCharState(std::make_shared<DefaultCharacterState>(this, maze_));
+    char_states_.clear();
+    addCharState(getCharState<DefaultCharacterState>(this));
     current_dir_ = RIGHT;
     future_dir_ = RIGHT;
-    position_ = default_position_;
+    teleport(default_position_);
     eatMode_ = false;
     super_mode = false;
     interactive_ = true;
@@ -147,12 +127,12 @@ void Player::reset()
 
 void Player::eat()
 {
-    addCharState(std::make_shared<PlayerEatState>(this, maze_));
+    addCharState(getCharState<PlayerEatState>(this));
 }
 
 void Player::die()
 {
-    addCharState(std::make_shared<PlayerDeadState>(this, maze_));
+    addCharState(getCharState<PlayerDeadState>(this));
     numLives = numLives - 1;
     notify(Observer::Event::LIFE_LOST);
 }
@@ -183,4 +163,51 @@ float Player::NormalSpeed()
     return speed;
 }
 
+/*------------------ Clips -------------------*/
+
+Player::Clips::Clips():
+    clips_(2*static_cast<size_t>(Look::COUNT))
+{
+}
+
+Player::Clips::Clips(map<string,texturePtr> textures)
+{
+    // Names of the textures in the order of the Look enumeration
+    const string names[] = {"left", "right", "up", "down",
+                            "super left", "super right", "super up", "super down",
+                            "hit left", "hit right", "hit up", "hit down",
+                            "hit super left", "hit super right", "hit super up", "hit super down",
+                            "dead"};
+    const auto tStep = 270.f;
+
+    for (auto prefix : {"", "kill "})
+    {
+        for (auto& name : names)
+        {
+            auto texture = textures.find(prefix + name);
+
+            if (texture == textures.end())
+                texture = textures.find(name);
+
+            if (texture == textures.end())
+            {
+                clips_.push_back(nullptr);
+                continue;
+            }
+
+            // The dead player lies down, so its frames are wider
+            auto frameSize = (name == "dead") ? sf::Vector2i{55,40} : sf::Vector2i{40,40};
+            clips_.push_back(Animator::makeClip(texture->second, frameSize, 0, tStep));
+        }
+    }
+}
+
+const Player::clipPtr& Player::Clips::get(Look look, bool isKilling) const
+{
+    auto index = static_cast<size_t>(look);
 
+    if (isKilling)
+        index += static_cast<size_t>(Look::COUNT);
+
+    return clips_[index];
+}
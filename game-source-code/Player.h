@@ -38,6 +38,49 @@ class Player : public Character, public Observer, public Subject
 {
     public:
 
+        /** \brief The different looks of the player, each of which has its own texture
+         *
+         *  The textures are looked up by name once, when the player is constructed, and
+         *  are indexed by this enumeration afterwards.
+         */
+        enum class Look {LEFT, RIGHT, UP, DOWN,
+                         SUPER_LEFT, SUPER_RIGHT, SUPER_UP, SUPER_DOWN,
+                         HIT_LEFT, HIT_RIGHT, HIT_UP, HIT_DOWN,
+                         HIT_SUPER_LEFT, HIT_SUPER_RIGHT, HIT_SUPER_UP, HIT_SUPER_DOWN,
+                         DEAD, COUNT};
+
+        /** \brief The animation clips of the player
+         *
+         *  A clip is made for every look, as well as a "kill" version of each look which is
+         *  shown while the player can eat the enemies. The clips are made once, when the
+         *  textures are given, so animating only has to index this table.
+         */
+        class Clips
+        {
+            public:
+                /** \brief Default constructor, which gives no clips */
+                Clips();
+
+                /** \brief Makes the clips from a map of textures
+                 *
+                 *  \param textures, a map<string,texturePtr> which maps a label to a texture pointer.
+                 *  A look with the "kill " prefix (e.g. "kill left") is used while the player can eat
+                 *  ghosts, falling back to the normal texture if it is not in the map.
+                 */
+                Clips(map<string,texturePtr> textures);
+
+                /** \brief Returns the clip of a look
+                 *
+                 *  \param look, the look of the player
+                 *  \param isKilling, true if the player can eat the enemies
+                 *  \returns The clip, which is null if its texture was not given
+                 */
+                const clipPtr& get(Look look, bool isKilling) const;
+
+            private:
+                vector<clipPtr> clips_; // all of the looks, followed by all of the kill looks
+        };
+
         /** \brief Default constructor for Player class */
         Player() {}
 
@@ -46,12 +89,12 @@ class Player : public Character, public Observer, public Subject
          *  Initialises a Character object using the Character constructor, as well as
          *  as some of its own data members such as the number of lives.
          *
-         *  \param textures, a map<string,texturePtr> which maps a label to a texture pointer
+         *  \param clips, the animation clips of the player (which can be given as a map of textures)
          *  \param position, an sf::Vector2f which contains the x and y coordinates of the
          *  default and initial position of the player
          *  \param maze, a pointer to the Maze
          */
-        Player(map<string,texturePtr> textures, sf::Vector2f position, mazePtr maze);
+        Player(Clips clips, sf::Vector2f position, mazePtr maze);
 
         /** \brief Default destructor for Player class */
         ~Player();
@@ -100,16 +143,15 @@ class Player : public Character, public Observer, public Subject
 
         /** \brief Animates the Player based on a time interval, dt
          *
-         *  This function overrides the abstract function provided by the base class, Character.
          *  The player sprite is animated, based on the time interval provided. The animate function
-         *  is called with 'textureKey' as a parameter. This is a key to the map of textures. Using
-         *  the selected texture along with the time passed in, the function determines which texture
-         *  to use, as well as which frame to select. It also enlarges the sprite if the Player is in
-         *  Super Mode.
+         *  is called with the look to show, which selects one of the precomputed clips. The sprite
+         *  is only changed when the clip or frame to show changes. It also enlarges the sprite if
+         *  the Player is in Super Mode.
          *
          *  \param dt, the time increment in milliseconds since the function was last called
+         *  \param look, the look of the player
          */
-        void animate(float dt, string textureKey)override;
+        void animate(float dt, Look look);
 
         /** \brief Performs action based on event passed in by Subjects
          *
@@ -202,12 +244,12 @@ class Player : public Character, public Observer, public Subject
 
     private:
 
+        Clips clips_;
         bool super_mode = false;
         bool eatMode_ = false;
         int ghostsEaten_ = 0;
         float timeEating_ = 0;
         int numLives;
-
 };
 
 #endif
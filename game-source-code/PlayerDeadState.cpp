@@ -16,9 +16,7 @@ void PlayerDeadState::update(float dt)
         player_->reset();
     }
 
-    string textureName = "dead";
-
-    player_->animate(dt, textureName);
+    player_->animate(dt, Player::Look::DEAD);
 }
 
 void PlayerDeadState::enter()
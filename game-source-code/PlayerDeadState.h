@@ -42,7 +42,7 @@ class PlayerDeadState: public CharacterStopState
          *  passed, the state is removed, and the player is reset by calling the
          *  reset() function.
          *
-         *  The function determines which textureKey to use based on its current
+         *  The function determines which look to use based on its current
          *  direction, and calls the 'animate' function of the player.
          *
          *  \param dt, the time interval in milliseconds since the last function call
@@ -62,7 +62,6 @@ class PlayerDeadState: public CharacterStopState
     private:
         playerPtr  player_;
         mazePtr maze_;
-        float timeInState_ = 0;
 };
 
 #endif
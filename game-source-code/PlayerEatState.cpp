@@ -17,40 +17,40 @@ void PlayerEatState::update(float dt)
         player_->removeCharState();
     }
 
-    string textureName;
+    auto look = Player::Look::HIT_RIGHT;
     if (player_->currentDir() == RIGHT)
     {
         if (player_->isSuper())
-            textureName = "hit super right";
+            look = Player::Look::HIT_SUPER_RIGHT;
         else
-            textureName = "hit right";
+            look = Player::Look::HIT_RIGHT;
     }
 
     if (player_->currentDir() == LEFT)
     {
         if (player_->isSuper())
-            textureName = "hit super left";
+            look = Player::Look::HIT_SUPER_LEFT;
         else
-            textureName = "hit left";
+            look = Player::Look::HIT_LEFT;
     }
 
     if (player_->currentDir() == UP)
     {
         if (player_->isSuper())
-            textureName = "hit super up";
+            look = Player::Look::HIT_SUPER_UP;
         else
-            textureName = "hit up";
+            look = Player::Look::HIT_UP;
     }
 
     if (player_->currentDir() == DOWN)
     {
         if (player_->isSuper())
-            textureName = "hit super down";
+            look = Player::Look::HIT_SUPER_DOWN;
         else
-            textureName = "hit down";
+            look = Player::Look::HIT_DOWN;
     }
 
-    player_->animate(dt, textureName);
+    player_->animate(dt, look);
 }
 
 void PlayerEatState::enter()
@@ -41,7 +41,7 @@ class PlayerEatState: public CharacterStopState
          *  If the time for this state, defined in the Configuration header file, has
          *  passed, the state is removed, and the player is set to be interactive again.
          *
-         *  The function determines which textureKey to use based on its current
+         *  The function determines which look to use based on its current
          *  direction, and calls the 'animate' function of the player.
          *
          *  \param dt, the time interval in milliseconds since the last function call
@@ -61,7 +61,6 @@ class PlayerEatState: public CharacterStopState
     private:
         playerPtr  player_;
         mazePtr maze_;
-        float timeInState_ = 0;
 
 };
 
@@ -16,8 +16,6 @@ void PlayerMovingState::movePlayer(float dt, float speed, playerPtr  player_, ma
         player_->updateDir();
     }
 
-    auto nodes = maze_->getNodes();
-
     auto position = player_->getSprite().getPosition();
 
     auto current_block = player_->getCurrentTile();
@@ -53,12 +51,12 @@ void PlayerMovingState::movePlayer(float dt, float speed, playerPtr  player_, ma
         else
             moveDistance = player_->futureDir()*(-1.f)*(maze_->getWidth()-maze_->getTileLength());
 
-        auto isValidNode = maze_->getTile(position + moveDistance)->isNode();
+        auto isValidNode = maze_->isNode(position + moveDistance);
 
         if (isValidNode)
         {
             player_->updateDir();
-            player_->moveCharacter(moveDistance);
+            player_->teleport(position + moveDistance);
         } else if (player_->futureDir() != player_->currentDir())
         {
             player_->updateDir();
@@ -69,11 +67,11 @@ void PlayerMovingState::movePlayer(float dt, float speed, playerPtr  player_, ma
 
 
 
-    if (!maze_->getTile(destination_block)->isNode() && (distance_to_node>=0)&&(distance_to_node<distance))
+    if (!maze_->isNode(destination_block) && (distance_to_node>=0)&&(distance_to_node<distance))
     {
         if (player_->currentDir() != float{-1}*player_->futureDir())
         {
-            if (maze_->getTile(current_block + player_->currentDir()*maze_->getTileLength())->isNode())
+            if (maze_->isNode(current_block + player_->currentDir()*maze_->getTileLength()))
             {
                  player_->moveCharacter(player_->currentDir()*distance);
                  return;
@@ -1,37 +1,36 @@
 #include "PlayerSuperState.h"
 #include <iostream>
-#include "GateTile.h"
 
 void PlayerSuperState::update(float dt)
 {
     timeInState_ += dt;
-    GateTile::isNode(true);
+    maze_->setGatesPassable(true);
 
     if (timeInState_ >= SUPER_MODE_TIME)
     {
-        GateTile::isNode(false);
+        maze_->setGatesPassable(false);
         player_->disableSuperMode();
     }
 
     movePlayer(dt, player_->SuperSpeed(), player_, maze_);
 
-    player_->animate(dt, getTextureName());
+    player_->animate(dt, getLook());
 }
 
 void PlayerSuperState::enter()
 {
 }
 
-string PlayerSuperState::getTextureName()
+Player::Look PlayerSuperState::getLook()
 {
     if (player_->currentDir() == RIGHT)
-        return "super right";
+        return Player::Look::SUPER_RIGHT;
     if (player_->currentDir() == LEFT)
-        return "super left";
+        return Player::Look::SUPER_LEFT;
     if (player_->currentDir() == UP)
-        return "super up";
+        return Player::Look::SUPER_UP;
     if (player_->currentDir() == DOWN)
-        return "super down";
+        return Player::Look::SUPER_DOWN;
     
-    return "super right";
+    return Player::Look::SUPER_RIGHT;
 }
@@ -47,7 +47,7 @@ class PlayerSuperState : public PlayerMovingState
          *  be of a node type, and activates whichever tile it is on, which has different
          *  behaviour depending on the tile.
          *
-         *  Finally the function determines which textureKey to use based on its current
+         *  Finally the function determines which look to use based on its current
          *  direction, and calls the 'animate' function of the player.
          *
          *  \param dt, the time interval in milliseconds since the last function call
@@ -61,9 +61,8 @@ class PlayerSuperState : public PlayerMovingState
     private:
         playerPtr  player_;
         mazePtr maze_;
-        float timeInState_ = 0;
 
-        string getTextureName();
+        Player::Look getLook();
 };
 
 #endif // PLAYER_SUPER_STATE_H
@@ -0,0 +1,132 @@
+#include "Profiler.h"
+
+#include <algorithm>
+#include <fstream>
+
+Profiler::Zone::Zone(Profiler& profiler, const char* name):
+    profiler_(profiler),
+    name_(name),
+    start_(profiler.isEnabled() ? profiler.getTime() : 0)
+{
+}
+
+Profiler::Zone::~Zone()
+{
+    if (profiler_.isEnabled())
+        profiler_.addEvent(name_, start_, profiler_.getTime());
+}
+
+Profiler::Profiler(size_t numFrames):
+    frames_(max(numFrames, size_t{1}))
+{
+}
+
+void Profiler::beginFrame()
+{
+    if (!isEnabled_)
+        return;
+
+    currentFrame_ = (currentFrame_ + 1) % frames_.size();
+
+    auto& frame = frames_[currentFrame_];
+    frame.start = getTime();
+    frame.duration = 0;
+    frame.events.clear();
+
+    isInFrame_ = true;
+}
+
+void Profiler::endFrame()
+{
+    if (!isEnabled_ || !isInFrame_)
+        return;
+
+    auto& frame = frames_[currentFrame_];
+    frame.duration = getTime() - frame.start;
+
+    numFrames_ = min(numFrames_ + 1, frames_.size());
+    isInFrame_ = false;
+}
+
+float Profiler::getFrameTime(float percentile) const
+{
+    auto numFinished = getNumFinished();
+
+    if (numFinished == 0)
+        return 0;
+
+    sortedTimes_.clear();
+
+    for (size_t i = 0; i < numFinished; i++)
+        sortedTimes_.push_back(getFinished(i).duration);
+
+    auto rank = static_cast<size_t>(percentile/100 * (sortedTimes_.size() - 1) + 0.5f);
+    rank = min(rank, sortedTimes_.size() - 1);
+    nth_element(sortedTimes_.begin(), sortedTimes_.begin() + rank, sortedTimes_.end());
+
+    return sortedTimes_[rank] / 1000.0f;
+}
+
+bool Profiler::writeChromeTrace(const string& filePath) const
+{
+    ofstream file{filePath};
+
+    if (!file)
+        return false;
+
+    file << "{\"traceEvents\":[";
+
+    auto isFirst = true;
+    auto writeEvent = [&](const char* name, long long start, long long duration)
+    {
+        if (!isFirst)
+            file << ",";
+
+        file << "\n{\"name\":\"" << name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << start << ",\"dur\":" << duration << "}";
+        isFirst = false;
+    };
+
+    // Oldest frame first
+    for (auto i = getNumFinished(); i > 0; i--)
+    {
+        auto& frame = getFinished(i - 1);
+
+        writeEvent("frame", frame.start, frame.duration);
+
+        for (auto& event : frame.events)
+            writeEvent(event.name, event.start, event.duration);
+    }
+
+    file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return static_cast<bool>(file);
+}
+
+/*------------- Private helper functions -------------*/
+
+long long Profiler::getTime() const
+{
+    return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - origin_).count();
+}
+
+size_t Profiler::getNumFinished() const
+{
+    // The frame in progress reuses the slot of the oldest finished frame
+    if (isInFrame_)
+        return min(numFrames_, frames_.size() - 1);
+
+    return numFrames_;
+}
+
+const Profiler::Frame& Profiler::getFinished(size_t age) const
+{
+    // Age 0 is the most recently finished frame
+    auto offset = age + (isInFrame_ ? 1 : 0);
+    return frames_[(currentFrame_ + frames_.size() - offset) % frames_.size()];
+}
+
+void Profiler::addEvent(const char* name, long long start, long long end)
+{
+    if (isInFrame_)
+        frames_[currentFrame_].events.push_back(Event{name, start, end - start});
+}
@@ -0,0 +1,111 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+/// \file Profiler.h
+/// \brief Contains the class definition for the "Profiler" class
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/// \class Profiler
+/// \brief Records how long each frame, and each zone of code within a frame, takes to run
+///
+/// The game loop marks the start and end of each frame, and the code to be measured is wrapped in a scoped Zone. The most recent frames are kept in a ring buffer, so recording does not allocate once every frame's buffer has grown to size. The frames can be written out as a Chrome trace (open chrome://tracing or https://ui.perfetto.dev and load the file), and frame time percentiles are available for the on-screen overlay (see ProfilerOverlay).
+///
+/// A disabled profiler records nothing, so zones cost almost nothing in headless games.
+
+class Profiler
+{
+public:
+    /// \class Zone
+    /// \brief Records the time from its construction to its destruction as a zone of the current frame
+    class Zone
+    {
+    public:
+        /// Constructor
+        /// @param profiler the profiler to record the zone in
+        /// @param name the name of the zone, which must outlive the profiler (a string literal)
+        Zone(Profiler& profiler, const char* name);
+
+        /// Destructor, which records the zone
+        ~Zone();
+
+        Zone(const Zone&) = delete;
+        Zone& operator=(const Zone&) = delete;
+
+    private:
+        Profiler& profiler_;
+        const char* name_;
+        long long start_;
+    };
+
+    /// Constructor
+    /// @param numFrames the number of recent frames to keep
+    Profiler(size_t numFrames = 600);
+
+    /// Enable or disable recording
+    /// @param isEnabled true if frames and zones should be recorded, and false otherwise
+    void setEnabled(bool isEnabled) {isEnabled_ = isEnabled;}
+
+    /// Query whether the profiler is recording
+    /// \return true if frames and zones are recorded, and false otherwise
+    bool isEnabled() const {return isEnabled_;}
+
+    /// Mark the start of a frame
+    void beginFrame();
+
+    /// Mark the end of the current frame
+    void endFrame();
+
+    /// Get the number of recorded frames
+    /// \return the number of finished frames, which is at most the number kept
+    size_t getNumFrames() const {return getNumFinished();}
+
+    /// Get a percentile of the recorded frame times
+    /// @param percentile the percentile, between 0 and 100 (e.g. 50 for the median)
+    /// \return the frame time in milliseconds, or 0 if no frames have been recorded
+    float getFrameTime(float percentile) const;
+
+    /// Write the recorded frames and zones to a file in the Chrome trace event format
+    /// @param filePath relative path to the trace file
+    /// \return true if the file was written, and false otherwise
+    bool writeChromeTrace(const string& filePath) const;
+
+private:
+    /// \struct A zone within a frame, with times in microseconds since the profiler was created
+    struct Event
+    {
+        const char* name;
+        long long start;
+        long long duration;
+    };
+
+    /// \struct A recorded frame and the zones within it
+    struct Frame
+    {
+        long long start = 0;
+        long long duration = 0;
+        vector<Event> events;
+    };
+
+    bool isEnabled_ = false;
+    chrono::steady_clock::time_point origin_ = chrono::steady_clock::now();
+
+    vector<Frame> frames_;
+    size_t currentFrame_ = 0;
+    size_t numFrames_ = 0;
+    bool isInFrame_ = false;
+
+    mutable vector<long long> sortedTimes_;     // scratch space for the percentiles
+
+    // Private helper functions
+    long long getTime() const;
+    size_t getNumFinished() const;
+    const Frame& getFinished(size_t age) const;
+    void addEvent(const char* name, long long start, long long end);
+};
+
+#endif
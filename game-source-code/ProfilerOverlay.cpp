@@ -0,0 +1,42 @@
+#include "ProfilerOverlay.h"
+
+#include "Configuration.h"
+
+#include <cstdio>
+
+ProfilerOverlay::ProfilerOverlay(const sf::Font& font, sf::Vector2f position)
+{
+    text_.setFont(font);
+    text_.setCharacterSize(14);
+    text_.setFillColor(sf::Color::White);
+    text_.setPosition(position + sf::Vector2f{8,6});
+
+    background_.setPosition(position);
+    background_.setSize(sf::Vector2f{250,68});
+    background_.setFillColor(sf::Color{0,0,0,180});
+
+    // Show the first results straight away
+    timeSinceRefresh_ = PROFILER_REFRESH_TIME;
+}
+
+void ProfilerOverlay::update(const Profiler& profiler, float dt)
+{
+    timeSinceRefresh_ += dt;
+
+    if (timeSinceRefresh_ < PROFILER_REFRESH_TIME)
+        return;
+
+    timeSinceRefresh_ = 0;
+
+    char text[128];
+    snprintf(text, sizeof(text), "FRAME p50 %5.2f ms\nFRAME p99 %5.2f ms\nFRAME max %5.2f ms",
+             profiler.getFrameTime(50), profiler.getFrameTime(99), profiler.getFrameTime(100));
+
+    text_.setString(text);
+}
+
+void ProfilerOverlay::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    target.draw(background_, states);
+    target.draw(text_, states);
+}
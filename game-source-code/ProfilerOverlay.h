@@ -0,0 +1,43 @@
+#ifndef PROFILER_OVERLAY_H
+#define PROFILER_OVERLAY_H
+
+/// \file ProfilerOverlay.h
+/// \brief Contains the class definition for the "ProfilerOverlay" class
+
+#include <SFML/Graphics.hpp>
+
+#include "Profiler.h"
+
+/// \class ProfilerOverlay
+/// \brief A small panel showing the frame time percentiles recorded by a Profiler
+///
+/// The text is only rebuilt a few times a second, so that the overlay does not add to the frame times it is showing.
+
+class ProfilerOverlay : public sf::Drawable
+{
+public:
+    /// Default constructor
+    ProfilerOverlay() {}
+
+    /// Constructor
+    /// @param font the font of the text
+    /// @param position the top left coordinates of the panel in the form sf::Vector2f{x,y}
+    ProfilerOverlay(const sf::Font& font, sf::Vector2f position);
+
+    /// Refresh the text, if enough time has passed since it was last refreshed
+    /// @param profiler the profiler to show
+    /// @param dt the time since the last call, in milliseconds
+    void update(const Profiler& profiler, float dt);
+
+    /// Overriding of SFML's draw function to draw the panel
+    /// @param target Render target to draw to
+    /// @param states Current render states
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+private:
+    sf::RectangleShape background_;
+    sf::Text text_;
+    float timeSinceRefresh_ = 0;
+};
+
+#endif
@@ -0,0 +1,96 @@
+#include "RenderLayer.h"
+
+#include <cstdlib>
+
+RenderLayer::RenderLayer(sf::FloatRect area, sf::Color clearColour):
+    area_{area},
+    clearColour_{clearColour}
+{}
+
+void RenderLayer::add(const sf::Drawable& drawable)
+{
+    drawables_.push_back(&drawable);
+    isDirty_ = true;
+}
+
+void RenderLayer::add(const Button& button)
+{
+    drawables_.push_back(&button);
+    buttons_.push_back(&button);
+    buttonRevisions_.push_back(button.getRevision());
+    isDirty_ = true;
+}
+
+void RenderLayer::clear()
+{
+    drawables_.clear();
+    buttons_.clear();
+    buttonRevisions_.clear();
+    isDirty_ = true;
+}
+
+void RenderLayer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    // The size of the layer's area in window pixels, which changes when the window is resized
+    auto topLeft = target.mapCoordsToPixel(sf::Vector2f{area_.left, area_.top});
+    auto bottomRight = target.mapCoordsToPixel(sf::Vector2f{area_.left + area_.width, area_.top + area_.height});
+    auto size = sf::Vector2u(abs(bottomRight.x - topLeft.x), abs(bottomRight.y - topLeft.y));
+
+    if (size.x == 0 || size.y == 0)
+        return;
+
+    if (!texture_ || texture_->getSize() != size || isOutOfDate())
+        render(size);
+
+    if (!texture_)
+        return;
+
+    auto sprite = sf::Sprite{texture_->getTexture()};
+    sprite.setPosition(area_.left, area_.top);
+    sprite.setScale(area_.width/size.x, area_.height/size.y);
+    target.draw(sprite, states);
+}
+
+/*------------- Private helper functions -------------*/
+
+bool RenderLayer::isOutOfDate() const
+{
+    if (isDirty_)
+        return true;
+
+    for (auto i = 0u; i < buttons_.size(); i++)
+    {
+        if (buttons_[i]->getRevision() != buttonRevisions_[i])
+            return true;
+    }
+
+    return false;
+}
+
+void RenderLayer::render(sf::Vector2u size) const
+{
+    if (!texture_ || texture_->getSize() != size)
+    {
+        texture_ = make_unique<sf::RenderTexture>();
+
+        if (!texture_->create(size.x, size.y))
+        {
+            texture_.reset();
+            return;
+        }
+    }
+
+    texture_->setView(sf::View{area_});
+    texture_->clear(clearColour_);
+
+    for (auto drawable : drawables_)
+        texture_->draw(*drawable);
+
+    texture_->display();
+
+    for (auto i = 0u; i < buttons_.size(); i++)
+        buttonRevisions_[i] = buttons_[i]->getRevision();
+
+    isDirty_ = false;
+    numRenders_++;
+}
@@ -0,0 +1,81 @@
+#ifndef RENDER_LAYER_H
+#define RENDER_LAYER_H
+
+/// \file RenderLayer.h
+/// \brief Contains the class definition for the "RenderLayer" class
+
+#include <SFML/Graphics.hpp>
+
+#include "Button.h"
+
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+/// \class RenderLayer
+/// \brief A group of drawables that rarely change, rendered once into a texture and then drawn as a single sprite
+///
+/// The layer keeps pointers to the drawables added to it, which must outlive it (normally they are members of the same state). It is rendered again only when it is invalidated, when a button on it changes appearance (see Button::getRevision), or when the window is resized, so a screen that is not being interacted with costs one draw call per frame. The texture matches the size of the layer's area in window pixels, so text stays as sharp as if it were drawn directly.
+///
+/// The layer must be drawn by the thread that owns the window's OpenGL context, so it is only suitable for states that are drawn with draw() rather than from a snapshot.
+
+class RenderLayer : public sf::Drawable
+{
+public:
+    /// Default constructor
+    RenderLayer() {}
+
+    /// Constructor
+    /// @param area the area of the view covered by the layer
+    /// @param clearColour the colour of the parts of the layer that nothing is drawn on
+    RenderLayer(sf::FloatRect area, sf::Color clearColour = sf::Color::Transparent);
+
+    RenderLayer(const RenderLayer&) = delete;
+    RenderLayer& operator=(const RenderLayer&) = delete;
+
+    /// Add a drawable to the layer, on top of those already added
+    ///
+    /// The layer must be invalidated whenever the drawable changes
+    /// @param drawable the drawable, which must outlive the layer
+    void add(const sf::Drawable& drawable);
+
+    /// Add a button to the layer, on top of the drawables already added
+    ///
+    /// The layer is rendered again whenever the button changes appearance
+    /// @param button the button, which must outlive the layer
+    void add(const Button& button);
+
+    /// Remove every drawable and button from the layer
+    void clear();
+
+    /// Mark the layer to be rendered again the next time it is drawn
+    void invalidate() {isDirty_ = true;}
+
+    /// Get the number of times the layer has been rendered into its texture
+    /// \return the number of renders
+    int getNumRenders() const {return numRenders_;}
+
+    /// Overriding of SFML's draw function to draw the layer, rendering it first if it is out of date
+    /// @param target Render target to draw to
+    /// @param states Current render states
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+private:
+    sf::FloatRect area_;
+    sf::Color clearColour_{sf::Color::Transparent};
+
+    vector<const sf::Drawable*> drawables_;     // buttons are also included here, in the order they were added
+    vector<const Button*> buttons_;
+
+    mutable unique_ptr<sf::RenderTexture> texture_;
+    mutable vector<int> buttonRevisions_;       // the revision of each button when the layer was last rendered
+    mutable bool isDirty_ = true;
+    mutable int numRenders_ = 0;
+
+    // Private helper functions
+    bool isOutOfDate() const;
+    void render(sf::Vector2u size) const;
+};
+
+#endif
@@ -0,0 +1,28 @@
+#include "RenderSnapshot.h"
+
+void RenderSnapshot::reset(sf::Color clearColour, const sf::View& view)
+{
+    clearColour_ = clearColour;
+    view_ = view;
+    items_.clear();
+}
+
+void RenderSnapshot::draw(sf::RenderWindow& window) const
+{
+    window.clear(clearColour_);
+    window.setView(view_);
+
+    for (const auto& item : items_)
+    {
+        if (auto drawable = get_if<drawablePtr>(&item))
+            window.draw(**drawable);
+        else if (auto sprite = get_if<sf::Sprite>(&item))
+            window.draw(*sprite);
+        else if (auto text = get_if<sf::Text>(&item))
+            window.draw(*text);
+        else
+            window.setView(get<sf::View>(item));
+    }
+
+    window.display();
+}
@@ -0,0 +1,55 @@
+#ifndef RENDER_SNAPSHOT_H
+#define RENDER_SNAPSHOT_H
+
+/// \file RenderSnapshot.h
+/// \brief Contains the class definition for the "RenderSnapshot" class
+
+#include <SFML/Graphics.hpp>
+
+#include <memory>
+#include <variant>
+#include <vector>
+
+using namespace std;
+
+/// \class RenderSnapshot
+/// \brief An immutable copy of everything a state draws in one frame
+///
+/// Sprites and text are copied by value, so that the state can carry on updating its own while the snapshot is being drawn on another thread. Larger drawables that rarely change (such as the maze) are shared instead, and must not be modified once they have been added. Items are drawn in the order in which they were added.
+
+class RenderSnapshot
+{
+public:
+    typedef shared_ptr<const sf::Drawable> drawablePtr; /**\typedef for a pointer to a shared, unchanging drawable, to improve readability */
+
+    /// Remove all items, keeping the memory allocated for them
+    /// @param clearColour the colour the window is cleared to before drawing
+    /// @param view the view the items are drawn with
+    void reset(sf::Color clearColour, const sf::View& view);
+
+    /// Change the view the items added after this are drawn with
+    void setView(const sf::View& view) {items_.emplace_back(view);}
+
+    /// Add a sprite to be drawn
+    void add(const sf::Sprite& sprite) {items_.emplace_back(sprite);}
+
+    /// Add text to be drawn
+    void add(const sf::Text& text) {items_.emplace_back(text);}
+
+    /// Add a shared drawable to be drawn
+    /// @param drawable a pointer to a drawable which will not be modified again
+    void add(drawablePtr drawable) {items_.emplace_back(move(drawable));}
+
+    /// Clear the window and draw every item to it
+    /// @param window the window to draw to
+    void draw(sf::RenderWindow& window) const;
+
+private:
+    typedef variant<sf::Sprite, sf::Text, drawablePtr, sf::View> Item;
+
+    sf::Color clearColour_;
+    sf::View view_;
+    vector<Item> items_;
+};
+
+#endif
@@ -0,0 +1,117 @@
+#include "RenderThread.h"
+
+RenderThread::~RenderThread()
+{
+    stop();
+}
+
+void RenderThread::start(sf::RenderWindow& window)
+{
+    if (isRunning())
+        return;
+
+    window_ = &window;
+    isPaused_ = true;
+    isNew_ = false;
+    isStopping_ = false;
+    thread_ = thread{&RenderThread::run, this};
+}
+
+void RenderThread::stop()
+{
+    if (!isRunning())
+        return;
+
+    {
+        auto lock = lock_guard<mutex>{mutex_};
+        isStopping_ = true;
+    }
+    condition_.notify_all();
+    thread_.join();
+
+    window_->setActive(true);
+    window_ = nullptr;
+}
+
+void RenderThread::pause()
+{
+    if (!isRunning())
+        return;
+
+    auto lock = unique_lock<mutex>{mutex_};
+    if (isPaused_)
+        return;
+
+    isPaused_ = true;
+    isNew_ = false;     // the snapshot may refer to textures that are about to be released
+    condition_.notify_all();
+    condition_.wait(lock, [this]{return !isActive_;});
+    window_->setActive(true);
+}
+
+void RenderThread::resume()
+{
+    if (!isRunning())
+        return;
+
+    auto lock = lock_guard<mutex>{mutex_};
+    if (!isPaused_)
+        return;
+
+    window_->setActive(false);
+    isPaused_ = false;
+    condition_.notify_all();
+}
+
+void RenderThread::publish()
+{
+    auto lock = unique_lock<mutex>{mutex_};
+    condition_.wait(lock, [this]{return !isNew_ || isPaused_ || isStopping_;});
+    swap(back_, ready_);
+    isNew_ = true;
+    condition_.notify_all();
+}
+
+/*------------- Private helper functions -------------*/
+
+void RenderThread::run()
+{
+    auto lock = unique_lock<mutex>{mutex_};
+
+    while (true)
+    {
+        condition_.wait(lock, [this]{return isStopping_ || (isPaused_ && isActive_) || (!isPaused_ && isNew_);});
+        if (isStopping_)
+            break;
+
+        // Hand the window back to the game thread
+        if (isPaused_)
+        {
+            window_->setActive(false);
+            isActive_ = false;
+            condition_.notify_all();
+            continue;
+        }
+
+        if (!isActive_)
+        {
+            window_->setActive(true);
+            isActive_ = true;
+        }
+
+        swap(ready_, front_);
+        isNew_ = false;
+        condition_.notify_all();
+
+        // Draw without holding the lock, so that the next snapshot can be published meanwhile
+        lock.unlock();
+        buffers_[front_].draw(*window_);
+        lock.lock();
+    }
+
+    if (isActive_)
+    {
+        window_->setActive(false);
+        isActive_ = false;
+    }
+}
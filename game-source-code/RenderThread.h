@@ -0,0 +1,78 @@
+#ifndef RENDER_THREAD_H
+#define RENDER_THREAD_H
+
+/// \file RenderThread.h
+/// \brief Contains the class definition for the "RenderThread" class
+
+#include <SFML/Graphics.hpp>
+
+#include "RenderSnapshot.h"
+
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+/// \class RenderThread
+/// \brief Draws snapshots of the game on a separate thread, so that drawing one frame overlaps with updating the next
+///
+/// Snapshots are triple buffered: the game thread fills the back buffer and publishes it as the ready buffer, which the render thread swaps for the front buffer it draws from. Publishing waits until the previous snapshot has been picked up, so the game never runs more than one frame ahead of what is on screen.
+///
+/// Only one thread may use the window's OpenGL context at a time. The render thread takes the context when it draws its first snapshot, and hands it back when paused. The game thread must pause the render thread before drawing directly, loading textures, or closing the window.
+
+class RenderThread
+{
+public:
+    /// Default constructor
+    RenderThread() {}
+
+    /// Destructor, which stops the thread if it is running
+    ~RenderThread();
+
+    /// Start the thread, which is initially paused
+    /// @param window the window to draw to, which must outlive the thread
+    void start(sf::RenderWindow& window);
+
+    /// Stop the thread, handing the window back to the calling thread
+    void stop();
+
+    /// Query whether the thread has been started
+    /// \return true if the thread is running, and false otherwise
+    bool isRunning() const {return window_ != nullptr;}
+
+    /// Wait until the thread has finished drawing and released the window, then make the window active on the calling thread
+    void pause();
+
+    /// Release the window on the calling thread, so that the render thread can draw to it again
+    void resume();
+
+    /// Get the snapshot to be filled in for the next frame
+    /// \return a reference to the back buffer
+    RenderSnapshot& getBackBuffer() {return buffers_[back_];}
+
+    /// Hand the back buffer to the render thread to be drawn
+    void publish();
+
+private:
+    sf::RenderWindow* window_ = nullptr;
+    thread thread_;
+    mutex mutex_;
+    condition_variable condition_;
+
+    array<RenderSnapshot, 3> buffers_;
+    int back_ = 0;
+    int ready_ = 1;
+    int front_ = 2;
+
+    bool isNew_ = false;          // the ready buffer has not been drawn yet
+    bool isPaused_ = true;
+    bool isActive_ = false;       // the window is active on the render thread
+    bool isStopping_ = false;
+
+    // Private helper functions
+    void run();
+};
+
+#endif
@@ -0,0 +1,14 @@
+#include "Replay.h"
+
+Replay::Replay(const string& mazeName, int lvlNumber, int startScore, unsigned int seed):
+mazeName_{mazeName},
+lvlNumber_{lvlNumber},
+startScore_{startScore},
+seed_{seed}
+{
+}
+
+void Replay::record(unsigned int tick, Input input)
+{
+    events_.push_back(Event{tick, input});
+}
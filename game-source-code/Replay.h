@@ -0,0 +1,79 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+/// \file Replay.h
+/// \brief Contains the class definition for the "Replay" class
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/// \class Replay
+/// \brief A recording of everything needed to play a level again exactly as it happened
+///
+/// A level is fully determined by the maze, the level number, the score it started with, the seed of its random numbers and the player's input on each update tick (every update uses the fixed MS_PER_FRAME time step). Replaying the same inputs on the same ticks therefore reproduces the level exactly, no matter how fast or slowly it is run. Replays are written to and read from a compact binary file by the FileWriter and FileReader.
+
+class Replay
+{
+public:
+    /// \enum The inputs that steer the player
+    enum class Input : unsigned char {UP, DOWN, LEFT, RIGHT};
+
+    /// \struct An input and the update tick it is applied on
+    struct Event
+    {
+        unsigned int tick;
+        Input input;
+    };
+
+    /// Default constructor
+    Replay() {}
+
+    /// Constructor
+    /// @param mazeName the name of the maze being played
+    /// @param lvlNumber the level number
+    /// @param startScore the score at the start of the level
+    /// @param seed the seed of the level's random numbers
+    Replay(const string& mazeName, int lvlNumber, int startScore, unsigned int seed);
+
+    /// Record an input
+    ///
+    /// Inputs must be recorded in order, and are applied at the start of the given tick
+    /// @param tick the update tick the input is applied on
+    /// @param input the input
+    void record(unsigned int tick, Input input);
+
+    /// Set the number of update ticks that the recording lasts
+    /// @param numTicks the number of ticks
+    void setLength(unsigned int numTicks) {length_ = numTicks;}
+
+    /// \return the name of the maze being played
+    const string& getMazeName() const {return mazeName_;}
+
+    /// \return the level number
+    int getLevelNumber() const {return lvlNumber_;}
+
+    /// \return the score at the start of the level
+    int getStartScore() const {return startScore_;}
+
+    /// \return the seed of the level's random numbers
+    unsigned int getSeed() const {return seed_;}
+
+    /// \return the number of update ticks that the recording lasts
+    unsigned int getLength() const {return length_;}
+
+    /// \return the recorded inputs, in the order they are applied
+    const vector<Event>& getEvents() const {return events_;}
+
+private:
+    string mazeName_;
+    int lvlNumber_ = 1;
+    int startScore_ = 0;
+    unsigned int seed_ = 0;
+    unsigned int length_ = 0;
+
+    vector<Event> events_;
+};
+
+#endif
@@ -0,0 +1,74 @@
+#include "ReplayState.h"
+#include "MainMenuState.h"
+#include "Soundboard.h"
+
+ReplayState::ReplayState(gamePtr game, const Replay& replay): game_{game}, level_{game, replay}
+{
+}
+
+void ReplayState::initialise()
+{
+    level_.initialise();
+}
+
+void ReplayState::processInput()
+{
+    sf::Event event;
+
+    while (game_->inputManager.pollEvent(game_->window, event))
+    {
+        if (game_->inputManager.isExitRequest(event))
+            game_->closeWindow();
+
+        if (event.type == sf::Event::Resized)
+            game_->view = game_->inputManager.getLetterboxView(game_->view, event.size.width, event.size.height);
+
+        if (event.type == sf::Event::KeyPressed)
+        {
+            switch (event.key.code)
+            {
+            case sf::Keyboard::Num1:
+                speed_ = 1;
+                break;
+            case sf::Keyboard::Num2:
+                speed_ = 4;
+                break;
+            case sf::Keyboard::Num3:
+                speed_ = 100;
+                break;
+            case sf::Keyboard::BackSpace:
+                leave();
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
+
+void ReplayState::update(float dt)
+{
+    for (auto i = 0; i < speed_ && !level_.isOver(); i++)
+        level_.update(dt);
+
+    if (level_.isOver())
+        leave();
+}
+
+void ReplayState::draw(float dt)
+{
+    level_.draw(dt);
+}
+
+bool ReplayState::snapshot(RenderSnapshot& snapshot, float dt)
+{
+    return level_.snapshot(snapshot, dt);
+}
+
+/*------------- Private helper functions -------------*/
+
+void ReplayState::leave()
+{
+    Soundboard{game_}.gotoMenu();
+    game_->stateMachine.addState(make_unique<MainMenuState>(game_));
+}
@@ -0,0 +1,42 @@
+#ifndef REPLAY_STATE_H
+#define REPLAY_STATE_H
+
+/// \file ReplayState.h
+/// \brief Contains the class definition for the "ReplayState" class
+
+#include <SFML/Graphics.hpp>
+
+#include "State.h"
+#include "GameLoop.h"
+#include "EndlessLevelState.h"
+#include "Replay.h"
+
+/// \class ReplayState
+/// \brief A state which plays back a recorded level on screen
+///
+/// The recorded level is run by an EndlessLevelState in replay mode, and is drawn as normal. The playback speed can be changed to 1x, 4x or 100x with the 1, 2 and 3 keys, in which case the level is updated that many times per frame. Backspace (or reaching the end of the recording) returns to the main menu.
+
+class ReplayState: public State
+{
+public:
+    /// Constructor
+    /// @param game a shared pointer to a structure containing the game's state machine, asset manager, input manager and display window
+    /// @param replay the recording of the level to play back
+    ReplayState(gamePtr game, const Replay& replay);
+
+    void initialise() override;
+    void processInput() override;
+    void update(float dt) override;
+    void draw(float dt) override;
+    bool snapshot(RenderSnapshot& snapshot, float dt) override;
+
+private:
+    gamePtr game_;
+    EndlessLevelState level_;
+    int speed_ = 1;
+
+    // Private helper functions
+    void leave();
+};
+
+#endif
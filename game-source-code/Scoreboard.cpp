@@ -2,24 +2,9 @@
 #include <iostream>
 #include <cmath>
 
-/*--------Static----------*/
-int Scoreboard::endScore = 0;
-
-void Scoreboard::endGame()
-{
-    endScore = current_score_;
-}
-
-int Scoreboard::getEndScore()
+Scoreboard::Scoreboard(vector<pair<string,int> > highscores, int startScore) :
+    current_score_(startScore), highscores_(highscores)
 {
-    return endScore;
-}
-/*-----------------------*/
-
-Scoreboard::Scoreboard(vector<pair<string,int> > highscores) :
-    highscores_(highscores)
-{
-    current_score_ = endScore;
 }
 
 void Scoreboard::increaseScore(const int amount)
@@ -34,21 +19,19 @@ void Scoreboard::EatMultiplier(const int mult)
 
 void Scoreboard::updateHighScores(string name)
 {
-    if (name.size() > 0 && endScore > getFifthScore())
+    if (name.size() > 0 && current_score_ > getFifthScore())
         {
             for (int i = 0; i < 5; i++)
             {
-                if (endScore > highscores_[i].second)
+                if (current_score_ > highscores_[i].second)
                 {
-                    highscores_.insert(highscores_.begin()+i, make_pair(name, getEndScore()));
+                    highscores_.insert(highscores_.begin()+i, make_pair(name, current_score_));
                     break;
                 }
             }
 
             highscores_.erase(highscores_.begin()+5);
         }
-
-    endScore = 0;
 }
 
 void Scoreboard::onNotify(Event event)
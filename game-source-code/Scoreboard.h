@@ -27,14 +27,15 @@ class Scoreboard : public Observer
 
         /** \brief Constructs Scoreboard object with initialisation list
          *
-         *  Initialises the high scores and sets the current score to the last
-         *  end score (a static variable). If in the beginning of a game, this will
-         *  set the score to 0 but carry the score at the end of a previous game through
-         *  to the next.
+         *  Initialises the high scores and sets the current score to the given
+         *  starting score. If in the beginning of a game, this will be 0, otherwise
+         *  it is the end score of the previous level (see Game::endScore) so that the
+         *  score is carried through to the next.
          *
          * \param highscores, a vector<pair<string,int>> of the high score list for the current maze.
+         * \param startScore, an integer, the score to start counting from
          */
-        Scoreboard(vector<pair<string,int> > highscores);
+        Scoreboard(vector<pair<string,int> > highscores, int startScore = 0);
 
         virtual ~Scoreboard() {}
 
@@ -79,23 +80,13 @@ class Scoreboard : public Observer
             */
         vector<pair<string,int>> getHighScores() const { return highscores_; };
 
-        /** \brief Sets the static end score to the current score */
-        void endGame();
-
-        /** \brief returns the static end score variable which was the score at the end of the
-                    previous game
-            \returns an integer, the static end score variable */
-        static int getEndScore();
-
     protected:
 
     private:
-        int current_score_;
+        int current_score_ = 0;
         int ghost_counter_ = 0;
         int n = 1;
 
-        static int endScore;
-
         vector<pair<string,int>> highscores_;
         std::string text_ = "";
 
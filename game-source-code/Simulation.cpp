@@ -0,0 +1,70 @@
+#include "Simulation.h"
+
+#include "Configuration.h"
+
+Simulation::Simulation(const string& mazeName, int lvlNumber, unsigned int seed)
+{
+    game_->isHeadless = true;
+    game_->randomEngine.seed(seed);
+
+    // The level is owned here rather than by the state machine, since it never moves on to another state
+    level_ = make_unique<EndlessLevelState>(game_, mazeName, lvlNumber);
+    level_->initialise();
+}
+
+Simulation::Simulation(const Replay& replay)
+{
+    game_->isHeadless = true;
+
+    level_ = make_unique<EndlessLevelState>(game_, replay);
+    level_->initialise();
+}
+
+void Simulation::pressKey(sf::Keyboard::Key key)
+{
+    sf::Event event;
+    event.type = sf::Event::KeyPressed;
+    event.key.code = key;
+    event.key.alt = false;
+    event.key.control = false;
+    event.key.shift = false;
+    event.key.system = false;
+
+    game_->inputManager.pushEvent(event);
+}
+
+int Simulation::step(int numFrames)
+{
+    auto framesSimulated = 0;
+
+    while (framesSimulated < numFrames && !isOver())
+    {
+        level_->processInput();
+        level_->update(MS_PER_FRAME);
+
+        framesSimulated++;
+        frameCount_++;
+    }
+
+    return framesSimulated;
+}
+
+bool Simulation::isOver() const
+{
+    return level_->isOver();
+}
+
+bool Simulation::isCleared() const
+{
+    return level_->isMazeClear();
+}
+
+int Simulation::getScore() const
+{
+    return level_->getScore();
+}
+
+int Simulation::getLivesLeft()
+{
+    return level_->getLivesLeft();
+}
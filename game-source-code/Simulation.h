@@ -0,0 +1,82 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+/// \file Simulation.h
+/// \brief Contains the class definition for the "Simulation" class
+
+#include <SFML/Graphics.hpp>
+
+#include "GameLoop.h"
+#include "EndlessLevelState.h"
+
+#include <memory>
+#include <string>
+
+using namespace std;
+
+/// \class Simulation
+/// \brief Runs a single level of the game headlessly, as fast as the CPU allows
+///
+/// The simulation builds its own headless Game, so no window is opened and no textures, fonts or audio are loaded. The level is stepped in fixed frames of MS_PER_FRAME, exactly as the game loop would update it, with key presses scripted through the input manager rather than coming from a keyboard. This makes it suitable for soak testing, AI evaluation and benchmarking on machines without a display.
+
+class Simulation
+{
+public:
+
+    /// Constructor
+    ///
+    /// Builds a headless game and initialises a level of the given maze
+    /// @param mazeName the name of the maze to play
+    /// @param lvlNumber the level number to start at
+    /// @param seed the seed of the game's random numbers, so that the same seed and input always give the same game
+    Simulation(const string& mazeName, int lvlNumber = 1, unsigned int seed = 0);
+
+    /// Constructor
+    ///
+    /// Builds a headless game that replays a recorded level as fast as possible. Any scripted key presses are ignored, and the simulation is over once the end of the recording is reached
+    /// @param replay the recording of the level
+    Simulation(const Replay& replay);
+
+    /// Queue a key press, which is processed at the start of the next frame as if it had come from the keyboard
+    /// @param key the key that is pressed
+    void pressKey(sf::Keyboard::Key key);
+
+    /// Advance the level by a number of frames
+    ///
+    /// The simulation stops early if the level ends (the maze is cleared or the player runs out of lives)
+    /// @param numFrames the number of frames to simulate
+    /// \return the number of frames that were actually simulated
+    int step(int numFrames = 1);
+
+    /// Check whether the level has ended
+    /// \return true if the maze has been cleared or the player has run out of lives, and false otherwise
+    bool isOver() const;
+
+    /// Check whether the level ended with the maze being cleared
+    /// \return true if all the food in the maze has been eaten, and false otherwise
+    bool isCleared() const;
+
+    /// Get the recording of the level so far
+    /// \return a reference to the level's replay
+    const Replay& getReplay() const {return level_->getReplay();}
+
+    /// Get the number of frames simulated so far
+    /// \return the number of frames
+    int getFrameCount() const {return frameCount_;}
+
+    /// Get the player's current score
+    /// \return the current score
+    int getScore() const;
+
+    /// Get the number of lives the player has left
+    /// \return the number of lives left
+    int getLivesLeft();
+
+private:
+    gamePtr game_ = make_shared<Game>();
+    unique_ptr<EndlessLevelState> level_;
+
+    int frameCount_ = 0;
+};
+
+#endif
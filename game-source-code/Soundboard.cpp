@@ -7,10 +7,10 @@ using namespace std;
 
 Soundboard::Soundboard(gamePtr game) : game_(game)
 {
-    numSongs_ = playList_.size();
+    numSongs_ = game_->playlist.size();
     for (int i = 0; i< numSongs_; i++)
     {
-        if (game_->assetManager.getStatus(playList_[i]) == sf::SoundSource::Status::Playing)
+        if (game_->assetManager.getStatus(game_->playlist[i]) == sf::SoundSource::Status::Playing)
         {
             currentSong_ = i;
         }
@@ -20,9 +20,9 @@ Soundboard::Soundboard(gamePtr game) : game_(game)
 Soundboard::Soundboard(gamePtr game, bool highScore) : game_(game)
 {
     if (highScore)
-        song_ = "xue hua piao";
+        song_ = Song::XUE_HUA_PIAO;
     else
-        song_ = "coffin dance";
+        song_ = Song::COFFIN_DANCE;
 
 
     game_->assetManager.playSong(song_);
@@ -36,7 +36,7 @@ Soundboard::~Soundboard()
 
 void Soundboard::gotoMenu()
 {
-    for (auto song : playList_)
+    for (auto song : game_->playlist)
     {
         if (game_->assetManager.getStatus(song) == sf::SoundSource::Status::Playing)
         {
@@ -44,7 +44,7 @@ void Soundboard::gotoMenu()
         }
     }
 
-    if (game_->assetManager.getStatus(song_) == sf::SoundSource::Status::Playing)
+    if (song_ != Song::COUNT && game_->assetManager.getStatus(song_) == sf::SoundSource::Status::Playing)
     {
         game_->assetManager.stopSong(song_);
     }
@@ -56,69 +56,69 @@ void Soundboard::restart()
 
     shufflePlaylist();
 
-    game_->assetManager.playSong(playList_[0]);
+    game_->assetManager.playSong(game_->playlist[0]);
 }
 
 
 void Soundboard::checkSong()
 {
-    if (game_->assetManager.getStatus(playList_[currentSong_]) != sf::SoundSource::Status::Playing)
+    if (game_->assetManager.getStatus(game_->playlist[currentSong_]) != sf::SoundSource::Status::Playing)
     {
         currentSong_++;
         if (currentSong_ == numSongs_)
             currentSong_ = 0;
 
-        game_->assetManager.playSong(playList_[currentSong_]);
+        game_->assetManager.playSong(game_->playlist[currentSong_]);
 
     }
 }
 
 void Soundboard::nextSong()
 {
-    game_->assetManager.stopSong(playList_[currentSong_]);
+    game_->assetManager.stopSong(game_->playlist[currentSong_]);
 
     currentSong_++;
     if (currentSong_ == numSongs_)
         currentSong_ = 0;
 
-    game_->assetManager.playSong(playList_[currentSong_]);
+    game_->assetManager.playSong(game_->playlist[currentSong_]);
 }
 
 void Soundboard::prevSong()
 {
-    game_->assetManager.stopSong(playList_[currentSong_]);
+    game_->assetManager.stopSong(game_->playlist[currentSong_]);
 
     currentSong_--;
     if (currentSong_ == -1)
         currentSong_ = numSongs_-1;
 
-    game_->assetManager.playSong(playList_[currentSong_]);
+    game_->assetManager.playSong(game_->playlist[currentSong_]);
 }
 
 void Soundboard::lastLife()
 {
-    game_->assetManager.stopSong(playList_[currentSong_]);
-    if (game_->assetManager.getStatus("damaged coda") != sf::SoundSource::Status::Playing)
+    game_->assetManager.stopSong(game_->playlist[currentSong_]);
+    if (game_->assetManager.getStatus(Song::DAMAGED_CODA) != sf::SoundSource::Status::Playing)
     {
-        game_->assetManager.playSong("damaged coda");
+        game_->assetManager.playSong(Song::DAMAGED_CODA);
     }
 }
 
 void Soundboard::gameOver()
 {
-    if (game_->assetManager.getStatus("damaged coda") == sf::SoundSource::Status::Playing)
-        game_->assetManager.stopSong("damaged coda");
+    if (game_->assetManager.getStatus(Song::DAMAGED_CODA) == sf::SoundSource::Status::Playing)
+        game_->assetManager.stopSong(Song::DAMAGED_CODA);
     else
-        game_->assetManager.stopSong(playList_[currentSong_]);
+        game_->assetManager.stopSong(game_->playlist[currentSong_]);
 }
 
 void Soundboard::nextLevel()
 {
-    if (game_->assetManager.getStatus("damaged coda") == sf::SoundSource::Status::Playing)
-            game_->assetManager.stopSong("damaged coda");
+    if (game_->assetManager.getStatus(Song::DAMAGED_CODA) == sf::SoundSource::Status::Playing)
+            game_->assetManager.stopSong(Song::DAMAGED_CODA);
 
-    if (game_->assetManager.getStatus(playList_[currentSong_]) != sf::SoundSource::Status::Playing)
-        game_->assetManager.playSong(playList_[currentSong_+1]);
+    if (game_->assetManager.getStatus(game_->playlist[currentSong_]) != sf::SoundSource::Status::Playing)
+        game_->assetManager.playSong(game_->playlist[currentSong_+1]);
 }
 
 void Soundboard::onNotify(Event event)
@@ -127,47 +127,43 @@ void Soundboard::onNotify(Event event)
     switch (event)
     {
         case Observer::Event::POWER_PELLET_EATEN:
-            assetManager.playSound("power pellet");
+            assetManager.playSound(Sound::POWER_PELLET);
             break;
         case Observer::Event::SUPER_PELLET_EATEN:
-            assetManager.playSound("super pellet");
+            assetManager.playSound(Sound::SUPER_PELLET);
             break;
         case Observer::Event::FRUIT_EATEN:
             break;
         case Observer::Event::GHOST_EATEN:
-            assetManager.playSound("eat ghost");
+            assetManager.playSound(Sound::EAT_GHOST);
             break;
         case Observer::Event::KEY_EATEN:
-            assetManager.playSound("key");
+            assetManager.playSound(Sound::KEY);
             break;
         case Observer::Event::GATE_BROKEN:
-            assetManager.playSound("gate break");
+            assetManager.playSound(Sound::GATE_BREAK);
             break;
         case Observer::Event::LIFE_LOST:
-            assetManager.playSound("player die");
+            assetManager.playSound(Sound::PLAYER_DIE);
             break;
         default:
             break;
     }
 }
 
-/*-------------- Static Playlist -------------------*/
-vector<string> Soundboard::playList_ = PLAYLIST;
-default_random_engine Soundboard::engine_;
+/*-------------- Playlist -------------------*/
 
 void Soundboard::seedRandom()
 {
-   default_random_engine new_engine;
-   engine_ = new_engine;
-   engine_.seed(std::chrono::system_clock::now().time_since_epoch().count());
+   game_->randomEngine.seed(std::chrono::system_clock::now().time_since_epoch().count());
 }
 
 void Soundboard::shufflePlaylist()
 {
-   std::shuffle(playList_.begin(), playList_.end(), engine_);
+   std::shuffle(game_->playlist.begin(), game_->playlist.end(), game_->randomEngine);
 }
 
-vector<string> Soundboard::getPlaylist()
+vector<Song> Soundboard::getPlaylist() const
 {
-    return playList_;
+    return game_->playlist;
 }
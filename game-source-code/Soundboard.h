@@ -88,27 +88,25 @@ class Soundboard : public Observer
         /** \brief Plays the "Last Life" song */
         void lastLife();
 
-        /** \brief Seeds the default_random_engine */
-        static void seedRandom();
+        /** \brief Seeds the game's default_random_engine from the clock (it also seeds each level) */
+        void seedRandom();
 
-        /** \brief Shuffles the playlist using the STL shuffle function and a default_random_engine */
-        static void shufflePlaylist();
+        /** \brief Shuffles the game's playlist using the STL shuffle function and its default_random_engine */
+        void shufflePlaylist();
 
         /** \brief Returns the current playlist
-         *  \returns a vector<string> containing the names of the songs and order of the currrent playlist
+         *  \returns a vector<Song> containing the songs in the order of the currrent playlist
          */
-        static vector<string> getPlaylist();
+        vector<Song> getPlaylist() const;
 
     protected:
 
     private:
         gamePtr game_;
 
-        int numSongs_;
-        int currentSong_;
-        string song_;
-        static vector<string> playList_;
-        static default_random_engine engine_;
+        int numSongs_ = 0;
+        int currentSong_ = 0;
+        Song song_ = Song::COUNT;  // the game over song, if there is one
 };
 
 #endif // SOUNDBOARD_H
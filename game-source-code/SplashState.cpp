@@ -7,17 +7,22 @@
 #include <cmath>
 #include <iostream>
 
-SplashState::SplashState(gamePtr game): game_{game}
+SplashState::SplashState(gamePtr game): game_{game}, loader_{game->assetManager}
 {
     // error checking
 }
 
 void SplashState::initialise()  // I wonder if we should load EVERYTHING here so that access is easier later?
 {
-    // Loading all resources up front
-    loadSounds(game_->assetManager);
-    loadFonts(game_->assetManager);
-    loadTextures(game_->assetManager);
+    // Only what the splash screen shows is loaded straight away
+    game_->assetManager.loadTexture("splash background", SPLASH_BACKGROUND_FILEPATH);
+    game_->assetManager.loadFont("fine 8-bit", FINE_8_BIT_FONT_FILEPATH);
+
+    // Everything else is loaded in the background while the progress bar is shown
+    loadSounds(loader_);
+    loadFonts(loader_);
+    loadTextures(loader_);
+    loader_.start();
 
     loadBackground(game_->assetManager);
     loadPercentage(game_->assetManager);
@@ -28,10 +33,10 @@ void SplashState::processInput()
 {
     sf::Event event;
 
-    while (game_->window.pollEvent(event))
+    while (game_->inputManager.pollEvent(game_->window, event))
     {
         if (game_->inputManager.isExitRequest(event))
-            game_->window.close();
+            game_->closeWindow();
 
         if (event.type == sf::Event::Resized)
             game_->view = game_->inputManager.getLetterboxView(game_->view, event.size.width, event.size.height);
@@ -40,19 +45,27 @@ void SplashState::processInput()
 
 void SplashState::update(float dt)
 {
-    float elapsedTime = clock_.getElapsedTime().asSeconds();
+    loader_.update(ASSET_UPLOAD_BUDGET);
 
-    if (elapsedTime > SPLASH_DISPLAY_TIME)
-    {
-        game_->stateMachine.addState(make_unique<MainMenuState>(game_));
-    }
-    else
+    progress_ = loader_.getProgress();
+    bar_.setSize(sf::Vector2f{PROGRESS_BAR_WIDTH * progress_, PROGRESS_BAR_HEIGHT});
+    percentage_.setString(to_string(static_cast<int>(progress_ * 100)) + "%");
+
+    if (!loader_.isFinished())
+        return;
+
+    // The game cannot run with assets missing, so the splash screen stays up to say how many failed (each one is logged)
+    auto numFailed = game_->assetManager.getFailedAssets().size();
+
+    if (numFailed > 0)
     {
-        progress_ = elapsedTime/SPLASH_DISPLAY_TIME;
-        bar_.setSize(sf::Vector2f{PROGRESS_BAR_WIDTH * progress_, PROGRESS_BAR_HEIGHT});
-        percentage_.setString(to_string(static_cast<int>(progress_ * 100) + 1) + "%");
+        percentage_.setString(to_string(numFailed) + (numFailed == 1 ? " ASSET" : " ASSETS") + " FAILED TO LOAD");
+        percentage_.setOrigin(percentage_.getLocalBounds().width/2.0f, percentage_.getLocalBounds().height/2.0f);
+        return;
     }
 
+    Soundboard{game_}.seedRandom();
+    game_->stateMachine.addState(make_unique<MainMenuState>(game_));
 }
 
 void SplashState::draw(float dt)
@@ -71,160 +84,159 @@ void SplashState::draw(float dt)
 
 /*------------- Private helper functions -------------*/
 
-void SplashState::loadSounds(AssetManager& assetManager)
+void SplashState::loadSounds(AssetLoader& loader)
 {
     // SFX
-    assetManager.loadSoundBuffer("button click", BUTTON_SFX1_FILEPATH);
-    assetManager.loadSoundBuffer("select button", SELECT_BUTTON_SFX1_FILEPATH);
-    assetManager.loadSoundBuffer("key", KEY_SFX_FILEPATH);
-    assetManager.loadSoundBuffer("gate link", GATE_LINK_SFX_FILEPATH);
-    assetManager.loadSoundBuffer("super pellet", SUPER_PELLET_SFX_FILEPATH);
-    assetManager.loadSoundBuffer("power pellet", POWER_PELLET_SFX_FILEPATH);
-    assetManager.loadSoundBuffer("gate break", GATE_BREAK_SFX_FILEPATH);
-    assetManager.loadSoundBuffer("player die", PLAYER_DIE_SFX_FILEPATH);
-    assetManager.loadSoundBuffer("eat ghost", EAT_GHOST_SFX_FILEPATH);
-    assetManager.loadSoundBuffer("error", ERROR_BUTTON_SFX_FILEPATH);
+    loader.addSoundBuffer(Sound::BUTTON_CLICK, BUTTON_SFX1_FILEPATH);
+    loader.addSoundBuffer(Sound::SELECT_BUTTON, SELECT_BUTTON_SFX1_FILEPATH);
+    loader.addSoundBuffer(Sound::KEY, KEY_SFX_FILEPATH);
+    loader.addSoundBuffer(Sound::GATE_LINK, GATE_LINK_SFX_FILEPATH);
+    loader.addSoundBuffer(Sound::SUPER_PELLET, SUPER_PELLET_SFX_FILEPATH);
+    loader.addSoundBuffer(Sound::POWER_PELLET, POWER_PELLET_SFX_FILEPATH);
+    loader.addSoundBuffer(Sound::GATE_BREAK, GATE_BREAK_SFX_FILEPATH);
+    loader.addSoundBuffer(Sound::PLAYER_DIE, PLAYER_DIE_SFX_FILEPATH);
+    loader.addSoundBuffer(Sound::EAT_GHOST, EAT_GHOST_SFX_FILEPATH);
+    loader.addSoundBuffer(Sound::BUTTON_ERROR, ERROR_BUTTON_SFX_FILEPATH);
 
     // Songs
-    assetManager.loadMusic("coffin dance", COFFIN_DANCE_FILEPATH);
-    assetManager.loadMusic("unravel", UNRAVEL_FILEPATH);
-    assetManager.loadMusic("xue hua piao", XUE_HUA_PIAO_FILEPATH);
-    assetManager.loadMusic("giorno", GIORNO_FILEPATH);
-    assetManager.loadMusic("caramelldansen", CARAMELLDANSEN_FILEPATH);
-    assetManager.loadMusic("megalovania", MEGALOVANIA_FILEPATH);
-    assetManager.loadMusic("full metal", FULL_METAL_FILEPATH);
-    assetManager.loadMusic("crab rave", CRAB_RAVE_FILEPATH);
-    assetManager.loadMusic("deja vu", DEJA_VU_FILEPATH);
-    assetManager.loadMusic("running in 90s", RUNNING_IN_90S_FILEPATH);
-    assetManager.loadMusic("rick roll", RICK_ROLL_FILEPATH);
-    assetManager.loadMusic("levan polka", LEVAN_POLKA_FILEPATH);
-    assetManager.loadMusic("damaged coda", DAMAGED_CODA_FILEPATH);
-    assetManager.loadMusic("sandstorm", SANDSTORM_FILEPATH);
-    Soundboard::seedRandom();
+    loader.addMusic(Song::COFFIN_DANCE, COFFIN_DANCE_FILEPATH);
+    loader.addMusic(Song::UNRAVEL, UNRAVEL_FILEPATH);
+    loader.addMusic(Song::XUE_HUA_PIAO, XUE_HUA_PIAO_FILEPATH);
+    loader.addMusic(Song::GIORNO, GIORNO_FILEPATH);
+    loader.addMusic(Song::CARAMELLDANSEN, CARAMELLDANSEN_FILEPATH);
+    loader.addMusic(Song::MEGALOVANIA, MEGALOVANIA_FILEPATH);
+    loader.addMusic(Song::FULL_METAL, FULL_METAL_FILEPATH);
+    loader.addMusic(Song::CRAB_RAVE, CRAB_RAVE_FILEPATH);
+    loader.addMusic(Song::DEJA_VU, DEJA_VU_FILEPATH);
+    loader.addMusic(Song::RUNNING_IN_90S, RUNNING_IN_90S_FILEPATH);
+    loader.addMusic(Song::RICK_ROLL, RICK_ROLL_FILEPATH);
+    loader.addMusic(Song::LEVAN_POLKA, LEVAN_POLKA_FILEPATH);
+    loader.addMusic(Song::DAMAGED_CODA, DAMAGED_CODA_FILEPATH);
+    loader.addMusic(Song::SANDSTORM, SANDSTORM_FILEPATH);
 }
 
-void SplashState::loadFonts(AssetManager& assetManager)
+void SplashState::loadFonts(AssetLoader& loader)
 {
-    assetManager.loadFont("fine 8-bit", FINE_8_BIT_FONT_FILEPATH);
-    assetManager.loadFont("coarse 8-bit", COARSE_8_BIT_FONT_FILEPATH);
-    assetManager.loadFont("pressStart 8-bit", PRESS_START_8_BIT_FONT_FILEPATH);
-    assetManager.loadFont("ancient", ANCIENT_8_BIT_FONT_FILEPATH);
+    loader.addFont("coarse 8-bit", COARSE_8_BIT_FONT_FILEPATH);
+    loader.addFont("pressStart 8-bit", PRESS_START_8_BIT_FONT_FILEPATH);
+    loader.addFont("ancient", ANCIENT_8_BIT_FONT_FILEPATH);
 }
 
-void SplashState::loadTextures(AssetManager& assetManager)
+void SplashState::loadTextures(AssetLoader& loader)
 {
-    assetManager.loadTexture("splash background", SPLASH_BACKGROUND_FILEPATH);
-    assetManager.loadTexture("menu background", MENU_BACKGROUND_FILEPATH);
-    assetManager.loadTexture("aux background", AUX_BACKGROUND_FILEPATH);
-    assetManager.loadTexture("hs background", HS_BACKGROUND_FILEPATH);
-    assetManager.loadTexture("grass", GRASS_FILEPATH);
+    loader.addTexture("menu background", MENU_BACKGROUND_FILEPATH);
+    loader.addTexture("aux background", AUX_BACKGROUND_FILEPATH);
+    loader.addTexture("hs background", HS_BACKGROUND_FILEPATH);
+    loader.addTexture("grass", GRASS_FILEPATH);
 
     // Buttons
-    assetManager.loadTexture("menu button", MENU_BUTTON_FILEPATH);
-    assetManager.loadTexture("exit button", EXIT_BUTTON_FILEPATH);
-    assetManager.loadTexture("eraser", ERASE_BUTTON_FILEPATH);
-    assetManager.loadTexture("left triangle", LEFT_TRIANGLE_FILEPATH);
-    assetManager.loadTexture("right triangle", RIGHT_TRIANGLE_FILEPATH);
-    assetManager.loadTexture("blank-button", BLANK_BUTTON_FILEPATH);
-    assetManager.loadTexture("question mark", QUESTION_MARK_FILEPATH);
-
-    assetManager.loadTexture("player default", PLAYER_DEFAULT_FILEPATH); // delete these?
-    assetManager.loadTexture("player super", PLAYER_SUPER_FILEPATH);
-    assetManager.loadTexture("enemy default", ENEMY_DEFAULT_FILEPATH);
+    loader.addTexture("menu button", MENU_BUTTON_FILEPATH);
+    loader.addTexture("exit button", EXIT_BUTTON_FILEPATH);
+    loader.addTexture("eraser", ERASE_BUTTON_FILEPATH);
+    loader.addTexture("left triangle", LEFT_TRIANGLE_FILEPATH);
+    loader.addTexture("right triangle", RIGHT_TRIANGLE_FILEPATH);
+    loader.addTexture("blank-button", BLANK_BUTTON_FILEPATH);
+    loader.addTexture("question mark", QUESTION_MARK_FILEPATH);
+
+    loader.addTexture("player default", PLAYER_DEFAULT_FILEPATH); // delete these?
+    loader.addTexture("player super", PLAYER_SUPER_FILEPATH);
+    loader.addTexture("enemy default", ENEMY_DEFAULT_FILEPATH);
 
     // Maze textures
-    assetManager.loadTexture("empty", EMPTY_FILEPATH);
-    assetManager.loadTexture("wall", WALL_FILEPATH);
-    assetManager.loadTexture("corner", CORNER_FILEPATH);
-    assetManager.loadTexture("gate", GATE_FILEPATH);
-    assetManager.loadTexture("broken gate", BROKEN_GATE_FILEPATH);
-    assetManager.loadTexture("key", KEY_FILEPATH);
-    assetManager.loadTexture("fruit", BANANA_FILEPATH);
-    assetManager.loadTexture("power pellet", POWER_PELLET_FILEPATH);
-    assetManager.loadTexture("super pellet", SUPER_PELLET_FILEPATH);
+    loader.addTexture("empty", EMPTY_FILEPATH);
+    loader.addTexture("wall", WALL_FILEPATH);
+    loader.addTexture("corner", CORNER_FILEPATH);
+    loader.addTexture("gate", GATE_FILEPATH);
+    loader.addTexture("broken gate", BROKEN_GATE_FILEPATH);
+    loader.addTexture("key", KEY_FILEPATH);
+    loader.addTexture("fruit", BANANA_FILEPATH);
+    loader.addTexture("power pellet", POWER_PELLET_FILEPATH);
+    loader.addTexture("super pellet", SUPER_PELLET_FILEPATH);
 
     // Player textures
-    assetManager.loadTexture("left", HARAMBE_LEFT);
-    assetManager.loadTexture("right", HARAMBE_RIGHT);
-    assetManager.loadTexture("up", HARAMBE_UP);
-    assetManager.loadTexture("down", HARAMBE_DOWN);
-
-    assetManager.loadTexture("super left", SUPER_HARAMBE_LEFT);
-    assetManager.loadTexture("super right", SUPER_HARAMBE_RIGHT);
-    assetManager.loadTexture("super up", SUPER_HARAMBE_UP);
-    assetManager.loadTexture("super down", SUPER_HARAMBE_DOWN);
-
-    assetManager.loadTexture("kill left", KILL_HARAMBE_LEFT);
-    assetManager.loadTexture("kill right", KILL_HARAMBE_RIGHT);
-    assetManager.loadTexture("kill up", KILL_HARAMBE_UP);
-    assetManager.loadTexture("kill down", KILL_HARAMBE_DOWN);
-
-    assetManager.loadTexture("kill super left", KILL_SUPER_HARAMBE_LEFT);
-    assetManager.loadTexture("kill super right", KILL_SUPER_HARAMBE_RIGHT);
-    assetManager.loadTexture("kill super up", KILL_SUPER_HARAMBE_UP);
-    assetManager.loadTexture("kill super down", KILL_SUPER_HARAMBE_DOWN);
-
-    assetManager.loadTexture("hit left", HIT_HARAMBE_LEFT);
-    assetManager.loadTexture("hit right", HIT_HARAMBE_RIGHT);
-    assetManager.loadTexture("hit up", HIT_HARAMBE_UP);
-    assetManager.loadTexture("hit down", HIT_HARAMBE_DOWN);
-
-    assetManager.loadTexture("hit super left", HIT_SUPER_HARAMBE_LEFT);
-    assetManager.loadTexture("hit super right", HIT_SUPER_HARAMBE_RIGHT);
-    assetManager.loadTexture("hit super up", HIT_SUPER_HARAMBE_UP);
-    assetManager.loadTexture("hit super down", HIT_SUPER_HARAMBE_DOWN);
-
-    assetManager.loadTexture("harambe dead", HARAMBE_DEAD);
-    assetManager.loadTexture("harambe head", HARAMBE_HEAD );
-    assetManager.loadTexture("red police", RED_POLICE);
-    assetManager.loadTexture("green police", GREEN_POLICE);
-    assetManager.loadTexture("brown police", BROWN_POLICE);
-    assetManager.loadTexture("purple police", PURPLE_POLICE);
-    assetManager.loadTexture("blue police", BLUE_POLICE);
-
-    assetManager.loadTexture("police dead", POLICE_DEAD);
-
-    assetManager.loadTexture("red head", RED_HEAD);
-    assetManager.loadTexture("green head", GREEN_HEAD);
-    assetManager.loadTexture("purple head", PURPLE_HEAD);
-    assetManager.loadTexture("brown head", BROWN_HEAD);
+    loader.addTexture("left", HARAMBE_LEFT);
+    loader.addTexture("right", HARAMBE_RIGHT);
+    loader.addTexture("up", HARAMBE_UP);
+    loader.addTexture("down", HARAMBE_DOWN);
+
+    loader.addTexture("super left", SUPER_HARAMBE_LEFT);
+    loader.addTexture("super right", SUPER_HARAMBE_RIGHT);
+    loader.addTexture("super up", SUPER_HARAMBE_UP);
+    loader.addTexture("super down", SUPER_HARAMBE_DOWN);
+
+    loader.addTexture("kill left", KILL_HARAMBE_LEFT);
+    loader.addTexture("kill right", KILL_HARAMBE_RIGHT);
+    loader.addTexture("kill up", KILL_HARAMBE_UP);
+    loader.addTexture("kill down", KILL_HARAMBE_DOWN);
+
+    loader.addTexture("kill super left", KILL_SUPER_HARAMBE_LEFT);
+    loader.addTexture("kill super right", KILL_SUPER_HARAMBE_RIGHT);
+    loader.addTexture("kill super up", KILL_SUPER_HARAMBE_UP);
+    loader.addTexture("kill super down", KILL_SUPER_HARAMBE_DOWN);
+
+    loader.addTexture("hit left", HIT_HARAMBE_LEFT);
+    loader.addTexture("hit right", HIT_HARAMBE_RIGHT);
+    loader.addTexture("hit up", HIT_HARAMBE_UP);
+    loader.addTexture("hit down", HIT_HARAMBE_DOWN);
+
+    loader.addTexture("hit super left", HIT_SUPER_HARAMBE_LEFT);
+    loader.addTexture("hit super right", HIT_SUPER_HARAMBE_RIGHT);
+    loader.addTexture("hit super up", HIT_SUPER_HARAMBE_UP);
+    loader.addTexture("hit super down", HIT_SUPER_HARAMBE_DOWN);
+
+    loader.addTexture("harambe dead", HARAMBE_DEAD);
+    loader.addTexture("harambe head", HARAMBE_HEAD );
+    loader.addTexture("red police", RED_POLICE);
+    loader.addTexture("green police", GREEN_POLICE);
+    loader.addTexture("brown police", BROWN_POLICE);
+    loader.addTexture("purple police", PURPLE_POLICE);
+    loader.addTexture("blue police", BLUE_POLICE);
+
+    loader.addTexture("police dead", POLICE_DEAD);
+
+    loader.addTexture("red head", RED_HEAD);
+    loader.addTexture("green head", GREEN_HEAD);
+    loader.addTexture("purple head", PURPLE_HEAD);
+    loader.addTexture("brown head", BROWN_HEAD);
 
     // Coffin textures
-    assetManager.loadTexture("coffin0", COFFIN_1);
-    assetManager.loadTexture("coffin1", COFFIN_2);
-    assetManager.loadTexture("coffin2", COFFIN_3);
-    assetManager.loadTexture("coffin3", COFFIN_4);
-    assetManager.loadTexture("coffin4", COFFIN_5);
-    assetManager.loadTexture("coffin5", COFFIN_6);
-    assetManager.loadTexture("coffin6", COFFIN_7);
-    assetManager.loadTexture("coffin7", COFFIN_8);
+    loader.addTexture("coffin0", COFFIN_1);
+    loader.addTexture("coffin1", COFFIN_2);
+    loader.addTexture("coffin2", COFFIN_3);
+    loader.addTexture("coffin3", COFFIN_4);
+    loader.addTexture("coffin4", COFFIN_5);
+    loader.addTexture("coffin5", COFFIN_6);
+    loader.addTexture("coffin6", COFFIN_7);
+    loader.addTexture("coffin7", COFFIN_8);
 
     // Piao Piao
-    assetManager.loadTexture("petal0", PETALS_1);
-    assetManager.loadTexture("petal1", PETALS_2);
-    assetManager.loadTexture("petal2", PETALS_3);
-    assetManager.loadTexture("petal3", PETALS_4);
-    assetManager.loadTexture("petal4", PETALS_5);
-    assetManager.loadTexture("petal5", PETALS_6);
-    assetManager.loadTexture("petal6", PETALS_7);
-    assetManager.loadTexture("petal7", PETALS_8);
-    assetManager.loadTexture("petal8", PETALS_9);
-    assetManager.loadTexture("petal9", PETALS_10);
-    assetManager.loadTexture("petal10", PETALS_11);
-
-    assetManager.loadTexture("sakura tree", SAKURA_TREE);
-    assetManager.loadTexture("piao piao", PIAO_PIAO);
+    loader.addTexture("petal0", PETALS_1);
+    loader.addTexture("petal1", PETALS_2);
+    loader.addTexture("petal2", PETALS_3);
+    loader.addTexture("petal3", PETALS_4);
+    loader.addTexture("petal4", PETALS_5);
+    loader.addTexture("petal5", PETALS_6);
+    loader.addTexture("petal6", PETALS_7);
+    loader.addTexture("petal7", PETALS_8);
+    loader.addTexture("petal8", PETALS_9);
+    loader.addTexture("petal9", PETALS_10);
+    loader.addTexture("petal10", PETALS_11);
+
+    loader.addTexture("sakura tree", SAKURA_TREE);
+    loader.addTexture("piao piao", PIAO_PIAO);
 
 }
 
 void SplashState::loadBackground(AssetManager& assetManager)
 {
-    background_.setTexture(*assetManager.getTexture("splash background"));
+    if (auto texture = assetManager.getTexture("splash background"))
+        background_.setTexture(*texture);
 }
 
 void SplashState::loadPercentage(AssetManager& assetManager)
 {
-    percentage_.setFont(*assetManager.getFont("fine 8-bit"));
+    if (auto font = assetManager.getFont("fine 8-bit"))
+        percentage_.setFont(*font);
 
     percentage_.setString("00%");
     percentage_.setOrigin(percentage_.getGlobalBounds().width/2.0f,
@@ -5,6 +5,7 @@
 
 #include "State.h"
 #include "GameLoop.h"
+#include "AssetLoader.h"
 
 typedef unique_ptr<sf::Drawable> drawablePtr;
 
@@ -23,7 +24,7 @@ public:
     
 private:
     gamePtr game_;
-    sf::Clock clock_;
+    AssetLoader loader_;
     float progress_ = 0;
     
     sf::Sprite background_;
@@ -34,9 +35,9 @@ private:
     vector<drawablePtr> drawables_;
     
     // Private helper functions
-    void loadSounds(AssetManager& assetManager);
-    void loadFonts(AssetManager& assetManager);
-    void loadTextures(AssetManager& assetManager);
+    void loadSounds(AssetLoader& loader);
+    void loadFonts(AssetLoader& loader);
+    void loadTextures(AssetLoader& loader);
 
     void loadBackground(AssetManager& assetManager);
     void loadTitle(AssetManager& assetManager);
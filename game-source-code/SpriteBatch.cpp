@@ -0,0 +1,59 @@
+#include "SpriteBatch.h"
+
+#include <algorithm>
+#include <cmath>
+
+void SpriteBatch::clear()
+{
+    for (auto& batch : batches_)
+        batch.vertices.clear();
+}
+
+void SpriteBatch::add(const sf::Sprite& sprite)
+{
+    auto texture = sprite.getTexture();
+    if (!texture)
+        return;
+
+    auto batch = find_if(batches_.begin(), batches_.end(), [texture](auto& batch){return batch.texture == texture;});
+    if (batch == batches_.end())
+    {
+        batches_.push_back(Batch{texture, {}});
+        batch = prev(batches_.end());
+    }
+
+    // The same quad sf::Sprite would draw, transformed in advance
+    auto rect = sprite.getTextureRect();
+    auto width = static_cast<float>(abs(rect.width));
+    auto height = static_cast<float>(abs(rect.height));
+    auto left = static_cast<float>(rect.left);
+    auto top = static_cast<float>(rect.top);
+    auto right = left + rect.width;
+    auto bottom = top + rect.height;
+
+    const auto& transform = sprite.getTransform();
+    auto colour = sprite.getColor();
+    auto& vertices = batch->vertices;
+
+    vertices.push_back(sf::Vertex{transform.transformPoint(0, 0), colour, sf::Vector2f{left, top}});
+    vertices.push_back(sf::Vertex{transform.transformPoint(width, 0), colour, sf::Vector2f{right, top}});
+    vertices.push_back(sf::Vertex{transform.transformPoint(width, height), colour, sf::Vector2f{right, bottom}});
+    vertices.push_back(sf::Vertex{transform.transformPoint(0, height), colour, sf::Vector2f{left, bottom}});
+}
+
+int SpriteBatch::getNumDrawCalls() const
+{
+    return count_if(batches_.begin(), batches_.end(), [](auto& batch){return !batch.vertices.empty();});
+}
+
+void SpriteBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    for (auto& batch : batches_)
+    {
+        if (batch.vertices.empty())
+            continue;
+
+        states.texture = batch.texture;
+        target.draw(batch.vertices.data(), batch.vertices.size(), sf::Quads, states);
+    }
+}
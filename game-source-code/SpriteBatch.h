@@ -0,0 +1,51 @@
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+/// \file SpriteBatch.h
+/// \brief Contains the class definition for the "SpriteBatch" class
+
+#include <SFML/Graphics.hpp>
+
+#include <vector>
+
+using namespace std;
+
+/// \class SpriteBatch
+/// \brief Draws many sprites with one draw call for each texture they use
+///
+/// Each sprite added is turned into a quad in the vertex array of its texture. Sprites which share a texture are drawn in the order in which they were added, but the textures are drawn in the order in which they were first used, so the batch is only suitable for sprites whose overlaps do not matter (e.g. a crowd of enemies). The vertex arrays are kept when the batch is cleared, so refilling it every frame does not allocate.
+
+class SpriteBatch : public sf::Drawable
+{
+public:
+    /// Default constructor
+    SpriteBatch() {}
+
+    /// Remove all sprites, keeping the memory allocated for them
+    void clear();
+
+    /// Add a sprite to the batch
+    /// @param sprite the sprite, which is copied into the batch
+    void add(const sf::Sprite& sprite);
+
+    /// Get the number of draw calls needed to draw the batch
+    /// \return the number of different textures used by the sprites in the batch
+    int getNumDrawCalls() const;
+
+    /// Overriding of SFML's draw function to draw every sprite in the batch
+    /// @param target Render target to draw to
+    /// @param states Current render states
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+private:
+    /// \struct The quads of all the sprites using one texture
+    struct Batch
+    {
+        const sf::Texture* texture = nullptr;
+        vector<sf::Vertex> vertices;
+    };
+
+    vector<Batch> batches_;
+};
+
+#endif
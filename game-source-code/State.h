@@ -4,6 +4,8 @@
 /// \file State.h
 /// \brief Contains the class definition for the "State" class
 
+class RenderSnapshot;
+
 /// \class State
 /// \brief The base class that all state types must inherit
 ///
@@ -29,8 +31,20 @@ public:
     virtual void update(float dt) = 0;
     
     /// Render drawables to the game screen
-    /// @param dt the elapsed time in milliseconds
+    /// @param dt the fraction of an update step that has passed since the last update (between 0 and 1), used to interpolate movement
     virtual void draw(float dt) = 0;
+
+    /// Fill in a snapshot of what draw() would draw, so that it can be drawn on a separate thread (see RenderThread)
+    /// @param snapshot the snapshot to fill in, which should first be reset
+    /// @param dt the fraction of an update step that has passed since the last update (between 0 and 1)
+    /// \return true if the snapshot was filled in, and false if the state can only be drawn with draw()
+    virtual bool snapshot(RenderSnapshot& snapshot, float dt) {return false;}
+
+    /// Query how long the game may wait for input before updating and drawing the state again
+    ///
+    /// States that only change in response to input (e.g. menus) return a positive time, so that the game loop sleeps until an event arrives instead of drawing the same frame over and over. The time should be no longer than the state's animations can wait for their next frame
+    /// \return the longest wait in milliseconds, or 0 if the state must be updated and drawn every frame
+    virtual float getIdleTimeout() const {return 0.f;}
     
     /// Pause the current state
     virtual void pause() {};
@@ -42,6 +42,10 @@ public:
     /// Add or remove the current state according to the boolean flags set by addState() and removeState()
     void handleStateChange();
     
+    /// Query whether a state is waiting to be added or removed
+    /// \return true if the next call to handleStateChange() will change the current state, and false otherwise
+    bool isChangePending() const {return isAdding_ || isRemoving_;}
+
     /// Get a pointer to the current state
     /// \return a reference to a unique pointer that points to the current state
     statePtr& getCurrentState() {return states_.top();}
@@ -51,9 +55,9 @@ private:
     
     statePtr newState_;
     
-    bool isAdding_;
-    bool isRemoving_;
-    bool isReplacing_;
+    bool isAdding_ = false;
+    bool isRemoving_ = false;
+    bool isReplacing_ = false;
 };
 
 #endif
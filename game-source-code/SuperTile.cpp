@@ -1,9 +0,0 @@
-#include "SuperTile.h"
-#include "Maze.h"
-
-void SuperTile::activate()
-{
-    notify(Observer::Event::SUPER_PELLET_EATEN);
-    Maze::decrementFoodCount();
-    remove();
-}
@@ -23,10 +23,10 @@ void TutorialState::processInput()
 {
     sf::Event event;
 
-    while (game_->window.pollEvent(event))
+    while (game_->inputManager.pollEvent(game_->window, event))
     {
         if (game_->inputManager.isExitRequest(event))
-            game_->window.close();
+            game_->closeWindow();
         
         if (event.type == sf::Event::Resized)
             game_->view = game_->inputManager.getLetterboxView(game_->view, event.size.width, event.size.height);
@@ -35,7 +35,7 @@ void TutorialState::processInput()
         {
             if (exitButton_.isHover(game_->window))
             {
-                game_->assetManager.playSound("button click");
+                game_->assetManager.playSound(Sound::BUTTON_CLICK);
                 game_->stateMachine.addState(make_unique<MainMenuState>(game_));
             }
 
@@ -334,11 +334,11 @@ void TutorialState::nextPage()
 {
     if (pageNum_ == pages_.size() - 1)
     {
-        game_->assetManager.playSound("error");
+        game_->assetManager.playSound(Sound::BUTTON_ERROR);
     }
     else
     {
-        game_->assetManager.playSound("button click");
+        game_->assetManager.playSound(Sound::BUTTON_CLICK);
 
         pageNum_++;
         pageDisplay_.setString(to_string(pageNum_ + 1) + "/" + to_string(pages_.size()));
@@ -350,11 +350,11 @@ void TutorialState::previousPage()
 {
     if (pageNum_ == 0)
     {
-        game_->assetManager.playSound("error");
+        game_->assetManager.playSound(Sound::BUTTON_ERROR);
     }
     else
     {
-        game_->assetManager.playSound("button click");
+        game_->assetManager.playSound(Sound::BUTTON_CLICK);
 
         pageNum_--;
         pageDisplay_.setString(to_string(pageNum_ + 1) + "/" + to_string(pages_.size()));
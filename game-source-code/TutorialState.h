@@ -19,6 +19,7 @@ public:
     void processInput() override;
     void update(float dt) override;
     void draw(float dt) override;
+    float getIdleTimeout() const override {return IDLE_TIMEOUT;}
 
 private:
     gamePtr game_;
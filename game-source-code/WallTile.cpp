@@ -1,10 +0,0 @@
-#include "WallTile.h"
-
-/*---------------------------------------------
- 
- For if we want to implement behaviour later...
- 
- Example: Animate?
- 
- ---------------------------------------------*/
-
@@ -0,0 +1,59 @@
+/// \file AssetPacker.cpp
+/// \brief A tool that packs the game's images, sounds, music and fonts into the asset pack that it loads at startup
+///
+/// Usage: AssetPacker [resource directory] [pack file]
+///
+/// By default every image, sound and font under "resources" is packed into ASSET_PACK_FILEPATH. It must be run from the same directory as the game, since each file is found in the pack by the path it was packed from (e.g. "resources/graphics/grass.png"). Mazes, high scores and replays are written while the game runs, so they are never packed.
+
+#include "../game-source-code/Configuration.h"
+#include "../game-source-code/AssetPack.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+bool isPackable(const filesystem::path& path)
+{
+    const auto extensions = vector<string>{".png", ".jpg", ".bmp", ".wav", ".ogg", ".flac", ".ttf", ".otf"};
+
+    auto extension = path.extension().string();
+    transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c){return tolower(c);});
+
+    return find(extensions.begin(), extensions.end(), extension) != extensions.end();
+}
+
+int main(int argc, char* argv[])
+{
+    auto resourceDirectory = string{argc > 1 ? argv[1] : "resources"};
+    auto packPath = string{argc > 2 ? argv[2] : ASSET_PACK_FILEPATH};
+
+    auto filePaths = vector<string>{};
+    auto error = error_code{};
+
+    for (auto& entry : filesystem::recursive_directory_iterator{resourceDirectory, error})
+    {
+        if (entry.is_regular_file() && isPackable(entry.path()))
+            filePaths.push_back(entry.path().generic_string());
+    }
+
+    if (error)
+    {
+        cerr << "Could not read " << resourceDirectory << ": " << error.message() << endl;
+        return EXIT_FAILURE;
+    }
+
+    if (!AssetPack::write(packPath, filePaths))
+    {
+        cerr << "Could not write " << packPath << endl;
+        return EXIT_FAILURE;
+    }
+
+    cout << "Packed " << filePaths.size() << " files into " << packPath << endl;
+    return EXIT_SUCCESS;
+}
@@ -3,17 +3,14 @@
 
 #include "../game-source-code/Configuration.h"
 
-#include "../game-source-code/EmptyTile.h"
-#include "../game-source-code/WallTile.h"
-#include "../game-source-code/GateTile.h"
-#include "../game-source-code/KeyTile.h"
-#include "../game-source-code/FruitTile.h"
-#include "../game-source-code/SuperTile.h"
-#include "../game-source-code/PowerTile.h"
 
 #include "../game-source-code/Maze.h"
 #include "../game-source-code/FileReader.h"
+#include "../game-source-code/FileWriter.h"
+#include "../game-source-code/Replay.h"
 #include "../game-source-code/AssetManager.h"
+#include "../game-source-code/MazeFile.h"
+#include "../game-source-code/AssetPack.h"
 
 #include "../game-source-code/Player.h"
 #include "../game-source-code/Blinky.h"
@@ -21,10 +18,27 @@
 #include "../game-source-code/Inky.h"
 #include "../game-source-code/Clyde.h"
 
+#include "../game-source-code/Simulation.h"
+#include "../game-source-code/BatchSimulator.h"
+#include "../game-source-code/Profiler.h"
+#include "../game-source-code/FrameScheduler.h"
+#include "../game-source-code/Camera.h"
+#include "../game-source-code/EnemyRoster.h"
+#include "../game-source-code/SpriteBatch.h"
+#include "../game-source-code/CollisionGrid.h"
+#include "../game-source-code/CharacterStateStack.h"
+#include "../game-source-code/EnemyChaseState.h"
+#include "../game-source-code/EnemyScatterState.h"
+#include "../game-source-code/Button.h"
+
 #include <string>
 #include <iostream>
 #include <vector>
 #include <memory>
+#include <fstream>
+#include <thread>
+#include <chrono>
+#include <filesystem>
 
 
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
@@ -32,7 +46,6 @@
 
 using namespace std;
 
-typedef shared_ptr<Tile> tilePtr;
 typedef shared_ptr<sf::Texture> texturePtr;
 //Helper functions
 
@@ -87,6 +100,26 @@ Maze initializeMaze(){
 
 }
 
+Maze makeMaze(const vector<string>& layout, Maze::posKeyMap keyMap = {}, Maze::Observers observers = {})
+{
+    // A maze without textures, for testing the behaviour of its tiles
+    auto mazeData = Maze::Data{};
+    mazeData.layout = layout;
+    mazeData.rotationMap = vector<string>(layout.size(), string(layout[0].size(), '0'));
+    mazeData.keyMap = keyMap;
+    mazeData.startPos = vector<sf::Vector2f>(5, sf::Vector2f{0,0});
+
+    return Maze{mazeData, Maze::Textures{}, observers, sf::Vector2f{0,0}, 10.f};
+}
+
+class EventLog : public Observer
+{
+public:
+    // Records the events it is notified of, for testing which observers a maze notifies
+    void onNotify(Event event) override {events.push_back(event);}
+    vector<Event> events;
+};
+
 void collisions(Player& player, Enemy& enemy)
 {
      auto enemyTile = enemy.getCurrentTile();
@@ -192,159 +225,253 @@ void loadEnemyAssets(map<string,texturePtr>& enemy_sprites)
 
 // ------------- Tests for Tiles ----------------
 
-TEST_CASE("Tile constructor correctly initialises relevant data members")
+TEST_CASE("All consumable tiles are replaced by an empty tile when activated")
 {
-    auto position = sf::Vector2f{20,30};
-    auto angle = 45.f;
+    auto maze = makeMaze({"WWWWWW",
+                          "WKFPSW",
+                          "WWWWWW"});
 
-    auto texture = make_shared<sf::Texture>();
-    texture->loadFromFile(EMPTY_FILEPATH);
+    CHECK_FALSE(maze.isClear());
 
-    auto sprite = sf::Sprite{*texture};
-    sprite.setOrigin(sprite.getGlobalBounds().width/2.f,
-                     sprite.getGlobalBounds().height/2.f);
-    sprite.setPosition(position.x, position.y);
-    sprite.setRotation(angle);
+    for (auto x = 15.f; x < 55.f; x += 10.f)
+    {
+        maze.activate(sf::Vector2f{x,15});
+        CHECK(maze.getTileType(sf::Vector2f{x,15}) == Maze::TileType::EMPTY);
+    }
 
-    auto tile = EmptyTile{position, angle, texture};
+    CHECK(maze.isClear());
+}
 
-    CHECK(tile.getPosition() == position);
-    CHECK(tile.getAngle() == angle);
-    CHECK(tile.getSprite().getGlobalBounds()  == sprite.getGlobalBounds());
+TEST_CASE("All tile types can correctly identify whether they are a node")
+{
+    auto maze = makeMaze({"EWCGKFPS"});
+
+    CHECK(maze.isNode(sf::Vector2f{5,5}));
+    CHECK_FALSE(maze.isNode(sf::Vector2f{15,5}));
+    CHECK_FALSE(maze.isNode(sf::Vector2f{25,5}));
+    CHECK_FALSE(maze.isNode(sf::Vector2f{35,5}));
+    CHECK(maze.isNode(sf::Vector2f{45,5}));
+    CHECK(maze.isNode(sf::Vector2f{55,5}));
+    CHECK(maze.isNode(sf::Vector2f{65,5}));
+    CHECK(maze.isNode(sf::Vector2f{75,5}));
 }
 
-TEST_CASE("Sprite can be correctly set after initialisation")
+TEST_CASE("Gate tiles become nodes while gates are passable")
 {
-    auto texture = make_shared<sf::Texture>();
-    texture->loadFromFile(EMPTY_FILEPATH);
-    auto sprite = sf::Sprite{*texture};
+    auto maze = makeMaze({"EGE"});
+    auto gate = sf::Vector2f{15,5};
 
-    auto tile = EmptyTile{};
+    CHECK_FALSE(maze.isNode(gate));
 
-    tile.setSprite(sprite);
+    maze.setGatesPassable(true);
 
-    CHECK(tile.getSprite().getLocalBounds()  == sprite.getLocalBounds());
+    CHECK(maze.isNode(gate));
+    CHECK_FALSE(maze.isOpenNode(gate));
 }
 
-TEST_CASE("Tile can be correctly set for removal")
+TEST_CASE("Gate tiles become nodes when activated")
 {
-    auto tile = EmptyTile();
+    auto maze = makeMaze({"EGE"});
+    auto gate = sf::Vector2f{15,5};
 
-    CHECK_FALSE(tile.isRemoved());
+    CHECK_FALSE(maze.isNode(gate));
 
-    tile.remove();
+    maze.activate(gate);
 
-    CHECK(tile.isRemoved());
+    CHECK(maze.isOpenNode(gate));
+    CHECK(maze.isNeighbourNode(sf::Vector2f{5,5}, RIGHT));
 }
 
-TEST_CASE("All consumable tiles are set for removal when activated")
+TEST_CASE("Gate tiles change their appearance when activated, but only once")
 {
-    auto key = KeyTile{};
-    auto fruit = FruitTile{};
-    auto powerPellet = PowerTile{};
-    auto superPellet = SuperTile{};
+    auto maze = makeMaze({"EGE"});
+    auto gate = sf::Vector2f{15,5};
+    auto revision = maze.getRenderer().getRevision();
 
-    CHECK_FALSE(key.isRemoved());
-    CHECK_FALSE(fruit.isRemoved());
-    CHECK_FALSE(powerPellet.isRemoved());
-    CHECK_FALSE(superPellet.isRemoved());
+    maze.activate(gate);
 
-    key.activate();
-    fruit.activate();
-    powerPellet.activate();
-    superPellet.activate();
+    CHECK(maze.getTileType(gate) == Maze::TileType::GATE);
+    CHECK(maze.getRenderer().getRevision() == revision + 1);
 
-    CHECK(key.isRemoved());
-    CHECK(fruit.isRemoved());
-    CHECK(powerPellet.isRemoved());
-    CHECK(superPellet.isRemoved());
+    maze.activate(gate);
+
+    CHECK(maze.getRenderer().getRevision() == revision + 1);
 }
 
-TEST_CASE("All tile types can correctly identify whether they are a node")
+TEST_CASE("Key tiles remove their corresponding gate tiles")
 {
-    auto empty = EmptyTile{};
-    auto wall = WallTile{};
-    auto gate = GateTile{};
-    auto key = KeyTile{};
-    auto fruit = FruitTile{};
-    auto powerPellet = PowerTile{};
-    auto superPellet = SuperTile{};
-
-    CHECK(empty.isNode());
-    CHECK_FALSE(wall.isNode());
-    CHECK_FALSE(gate.isNode());
-    CHECK(key.isNode());
-    CHECK(fruit.isNode());
-    CHECK(powerPellet.isNode());
-    CHECK(superPellet.isNode());
+    // Key map entries are in the form (col,row)
+    auto keyMap = Maze::posKeyMap{};
+    keyMap[make_tuple(1,1)] = {make_tuple(3,1), make_tuple(2,2)};
+
+    auto maze = makeMaze({"WWWWW",
+                          "WKEGW",
+                          "WWGWW",
+                          "WWGWW"}, keyMap);
+
+    maze.activate(sf::Vector2f{15,15});
+
+    CHECK(maze.getTileType(sf::Vector2f{15,15}) == Maze::TileType::EMPTY);
+    CHECK(maze.getTileType(sf::Vector2f{35,15}) == Maze::TileType::EMPTY);
+    CHECK(maze.getTileType(sf::Vector2f{25,25}) == Maze::TileType::EMPTY);
+    CHECK(maze.isOpenNode(sf::Vector2f{35,15}));
+    CHECK(maze.getTileType(sf::Vector2f{25,35}) == Maze::TileType::GATE);
 }
 
-TEST_CASE("Gate tiles can be made into nodes statically")
+TEST_CASE("Activating a tile notifies the observers of that type of tile")
 {
-    auto gate = GateTile{};
+    auto player = EventLog{};
+    auto enemy = EventLog{};
+    auto scoreBoard = EventLog{};
+    auto soundBoard = EventLog{};
+
+    auto observers = Maze::Observers{};
+    observers.player = &player;
+    observers.enemies = {&enemy};
+    observers.scoreBoard = &scoreBoard;
+    observers.soundBoard = &soundBoard;
+
+    auto maze = makeMaze({"FPGEW"}, {}, observers);
+
+    maze.activate(sf::Vector2f{5,5});
+    maze.activate(sf::Vector2f{15,5});
+    maze.activate(sf::Vector2f{25,5});
+    maze.activate(sf::Vector2f{35,5});
+    maze.activate(sf::Vector2f{45,5});
+
+    using Event = Observer::Event;
+    CHECK(player.events == vector<Event>{Event::POWER_PELLET_EATEN});
+    CHECK(enemy.events == vector<Event>{Event::POWER_PELLET_EATEN});
+    auto scoreEvents = vector<Event>{Event::FRUIT_EATEN, Event::POWER_PELLET_EATEN};
+    auto soundEvents = vector<Event>{Event::FRUIT_EATEN, Event::POWER_PELLET_EATEN, Event::GATE_BROKEN};
+    CHECK(scoreBoard.events == scoreEvents);
+    CHECK(soundBoard.events == soundEvents);
+}
 
-    CHECK_FALSE(gate.isNode());
+// ------------- Tests for Maze ----------------
 
-    GateTile::isNode(true);
+TEST_CASE("Only walls, corners and closed gates are not nodes")
+{
+    auto maze = initializeMaze();
+    auto tileLength = maze.getTileLength();
 
-    CHECK(gate.isNode());
+    for (auto x = tileLength/2; x < maze.getWidth(); x += tileLength)
+    {
+        for (auto y = tileLength/2; y < maze.getHeight(); y += tileLength)
+        {
+            auto position = sf::Vector2f{x,y};
+            auto type = maze.getTileType(position);
+            auto isBlocking = (type == Maze::TileType::WALL ||
+                               type == Maze::TileType::CORNER ||
+                               type == Maze::TileType::GATE);
 
-    GateTile::isNode(false);
+            CHECK(maze.isNode(position) == !isBlocking);
+        }
+    }
 }
 
-TEST_CASE("Gate tiles become nodes when activated")
+TEST_CASE("Positions outside of the maze are not nodes")
 {
-    auto gate = GateTile{};
+    auto maze = initializeMaze();
+    auto tileLength = maze.getTileLength();
 
-    CHECK_FALSE(gate.isNode());
+    CHECK_FALSE(maze.isNode(sf::Vector2f{-tileLength, tileLength}));
+    CHECK_FALSE(maze.isNode(sf::Vector2f{maze.getWidth() + tileLength, tileLength}));
+    CHECK_FALSE(maze.isNode(sf::Vector2f{tileLength, maze.getHeight() + tileLength}));
+}
 
-    gate.activate();
+TEST_CASE("Tile positions are the centre of the tile containing the coordinates")
+{
+    auto maze = initializeMaze();
+    auto tileLength = maze.getTileLength();
+
+    auto centre = sf::Vector2f{2.5f*tileLength, 3.5f*tileLength};
 
-    CHECK(gate.isNode());
+    CHECK(maze.getTilePosition(centre) == centre);
+    CHECK(maze.getTilePosition(centre + sf::Vector2f{0.4f*tileLength, -0.4f*tileLength}) == centre);
 }
 
-TEST_CASE("Gate tiles change their sprite when activated")
+TEST_CASE("Broken gates become open nodes")
 {
-    auto normalTexture = make_shared<sf::Texture>();
-    normalTexture->loadFromFile(GATE_FILEPATH);
-    auto normalSprite = sf::Sprite{*normalTexture};
+    auto maze = initializeMaze();
+    auto tileLength = maze.getTileLength();
+
+    auto position = sf::Vector2f{-1,-1};
 
-    auto brokenTexture = make_shared<sf::Texture>();
-    brokenTexture->loadFromFile(BROKEN_GATE_FILEPATH);
-    auto brokenSprite = sf::Sprite{*brokenTexture};
+    for (auto x = tileLength/2; x < maze.getWidth(); x += tileLength)
+        for (auto y = tileLength/2; y < maze.getHeight(); y += tileLength)
+            if (maze.getTileType(sf::Vector2f{x,y}) == Maze::TileType::GATE)
+                position = sf::Vector2f{x,y};
 
-    auto gate = GateTile{sf::Vector2f{0,0}, 0.f, normalTexture, brokenTexture};
+    REQUIRE(position.x > 0);
 
-    CHECK(gate.getSprite().getLocalBounds() == normalSprite.getLocalBounds());
+    CHECK_FALSE(maze.isOpenNode(position));
+    for (auto dir : {UP, DOWN, LEFT, RIGHT})
+        CHECK_FALSE(maze.isNeighbourNode(position + tileLength*dir, float{-1}*dir));
 
-    gate.activate();
+    maze.activate(position);
 
-    CHECK(gate.getSprite().getLocalBounds() == brokenSprite.getLocalBounds());
+    CHECK(maze.isOpenNode(position));
+    for (auto dir : {UP, DOWN, LEFT, RIGHT})
+        if (maze.isOpenNode(position + tileLength*dir))
+            CHECK(maze.isNeighbourNode(position + tileLength*dir, float{-1}*dir));
 }
 
-TEST_CASE("Key tiles set their corresponding gate tiles to be removed")
+TEST_CASE("Eaten fruit is replaced by an empty tile")
 {
-    auto texture = make_shared<sf::Texture>();
-    texture->loadFromFile(KEY_FILEPATH);
+    auto maze = initializeMaze();
+    auto tileLength = maze.getTileLength();
 
-    auto gates = vector<tilePtr>(3, make_shared<GateTile>());
+    auto position = sf::Vector2f{-1,-1};
 
-    auto key = KeyTile{sf::Vector2f{0,0}, 0.f, texture, gates};
+    for (auto x = tileLength/2; x < maze.getWidth(); x += tileLength)
+        for (auto y = tileLength/2; y < maze.getHeight(); y += tileLength)
+            if (maze.getTileType(sf::Vector2f{x,y}) == Maze::TileType::FRUIT)
+                position = sf::Vector2f{x,y};
 
-    CHECK_FALSE(gates[0]->isRemoved());
-    CHECK_FALSE(gates[1]->isRemoved());
-    CHECK_FALSE(gates[2]->isRemoved());
+    REQUIRE(position.x > 0);
 
-    key.activate();
+    maze.activate(position);
 
-    CHECK(gates[0]->isRemoved());
-    CHECK(gates[1]->isRemoved());
-    CHECK(gates[2]->isRemoved());
+    CHECK(maze.getTileType(position) == Maze::TileType::EMPTY);
+    CHECK(maze.isNode(position));
 }
 
-// ------------- Tests for Maze ----------------
+TEST_CASE("Eating a key with no gates linked to it only removes the key")
+{
+    auto maze = makeMaze({"WWWWW",
+                          "WKEGW",
+                          "WWWWW"});
+    auto key = sf::Vector2f{15,15};
+    auto gate = sf::Vector2f{35,15};
 
+    maze.activate(key);
 
+    CHECK(maze.getTileType(key) == Maze::TileType::EMPTY);
+    CHECK(maze.getTileType(gate) == Maze::TileType::GATE);
+    CHECK_FALSE(maze.isOpenNode(gate));
+}
+
+TEST_CASE("Making gates passable only affects the maze it is called on")
+{
+    auto maze = initializeMaze();
+    auto otherMaze = initializeMaze();
+    auto tileLength = maze.getTileLength();
+
+    auto gatePosition = sf::Vector2f{-1,-1};
+
+    for (auto x = tileLength/2; x < maze.getWidth(); x += tileLength)
+        for (auto y = tileLength/2; y < maze.getHeight(); y += tileLength)
+            if (maze.getTileType(sf::Vector2f{x,y}) == Maze::TileType::GATE)
+                gatePosition = sf::Vector2f{x,y};
+
+    REQUIRE(gatePosition.x > 0);
+
+    maze.setGatesPassable(true);
+
+    CHECK(maze.isNode(gatePosition));
+    CHECK_FALSE(otherMaze.isNode(gatePosition));
+}
 
 // ------------- Tests for Characters ----------------
 
@@ -809,4 +936,766 @@ TEST_CASE("Player eats the enemy if it is in Super Mode and it collides with an
     CHECK(blinky.isFrightened() == false);
 }
 
+// ------------- Tests for Headless Simulation ----------------
+
+TEST_CASE("A headless simulation steps the level by the requested number of frames")
+{
+    auto simulation = Simulation{"Classic"};
+    auto lives = simulation.getLivesLeft();
+
+    simulation.pressKey(sf::Keyboard::Left);
+
+    CHECK(simulation.step(10) == 10);
+    CHECK(simulation.getFrameCount() == 10);
+    CHECK(simulation.getLivesLeft() == lives);
+    CHECK_FALSE(simulation.isOver());
+}
+
+
+TEST_CASE("A batch of simulations reports a result for every game")
+{
+    auto batch = BatchSimulator{"Classic", 8, 120};
+    auto results = batch.run(4);
+
+    CHECK(results.numGames == 8);
+    CHECK(results.scores.size() == 8);
+    CHECK(results.totalFrames <= 8*120);
+    CHECK(results.minScore <= results.medianScore);
+    CHECK(results.medianScore <= results.maxScore);
+    CHECK(results.clearRate >= 0.0f);
+    CHECK(results.clearRate <= 1.0f);
+}
+
+// ------------- Tests for Replays ----------------
+
+TEST_CASE("A replay is read back exactly as it was written")
+{
+    auto replay = Replay{"Classic", 3, 1250, 123456789u};
+    replay.record(0, Replay::Input::LEFT);
+    replay.record(0, Replay::Input::UP);
+    replay.record(200, Replay::Input::RIGHT);
+    replay.record(70000, Replay::Input::DOWN);
+    replay.setLength(70001);
+
+    FileWriter{}.writeFile(replay, "test.replay");
+
+    auto loaded = Replay{};
+    FileReader{}.readFile(loaded, "test.replay");
+
+    CHECK(loaded.getMazeName() == "Classic");
+    CHECK(loaded.getLevelNumber() == 3);
+    CHECK(loaded.getStartScore() == 1250);
+    CHECK(loaded.getSeed() == 123456789u);
+    CHECK(loaded.getLength() == 70001);
+    REQUIRE(loaded.getEvents().size() == 4);
+    CHECK(loaded.getEvents()[1].tick == 0);
+    CHECK(loaded.getEvents()[1].input == Replay::Input::UP);
+    CHECK(loaded.getEvents()[3].tick == 70000);
+    CHECK(loaded.getEvents()[3].input == Replay::Input::DOWN);
+
+    filesystem::remove("test.replay");
+}
+
+TEST_CASE("Writing a replay makes any missing folders in its path")
+{
+    auto replay = Replay{"Classic", 1, 0, 1u};
+    replay.record(5, Replay::Input::LEFT);
+    replay.setLength(10);
+
+    CHECK(FileWriter{}.writeFile(replay, "test_replays/nested/test.replay"));
+
+    auto loaded = Replay{};
+    FileReader{}.readFile(loaded, "test_replays/nested/test.replay");
+    CHECK(loaded.getLength() == 10);
+
+    filesystem::remove_all("test_replays");
+}
+
+TEST_CASE("A replay with a maze name longer than the limit is read as an empty replay")
+{
+    auto replay = Replay{string(MAX_REPLAY_NAME_LENGTH + 1, 'M'), 1, 0, 1u};
+    replay.setLength(10);
+    FileWriter{}.writeFile(replay, "corrupt.replay");
+
+    auto loaded = Replay{"Previous", 1, 0, 1u};
+    FileReader{}.readFile(loaded, "corrupt.replay");
+
+    CHECK(loaded.getMazeName() == "");
+    CHECK(loaded.getLength() == 0);
+    CHECK(loaded.getEvents().empty());
+
+    filesystem::remove("corrupt.replay");
+}
+
+TEST_CASE("A replay with an unknown input is read as an empty replay")
+{
+    auto replay = Replay{"Classic", 1, 0, 1u};
+    replay.record(5, Replay::Input::LEFT);
+    replay.setLength(10);
+    FileWriter{}.writeFile(replay, "corrupt.replay");
+
+    {
+        // The input is the last byte of the file
+        auto file = fstream{"corrupt.replay", fstream::in | fstream::out | fstream::binary};
+        file.seekp(-1, fstream::end);
+        file.put(static_cast<char>(0x7F));
+    }
+
+    auto loaded = Replay{"Previous", 1, 0, 1u};
+    FileReader{}.readFile(loaded, "corrupt.replay");
+
+    CHECK(loaded.getMazeName() == "");
+    CHECK(loaded.getEvents().empty());
+
+    filesystem::remove("corrupt.replay");
+}
+
+TEST_CASE("A replay with a number too big for 32 bits is read as an empty replay")
+{
+    {
+        auto file = ofstream{"corrupt.replay", ofstream::binary};
+        file.write(REPLAY_TAG, 4);
+        file.put(REPLAY_VERSION);
+        // A one letter name, level 1, a start score of 0 and a seed of 1
+        const char header[] = {1, 'C', 1, 0, 1};
+        file.write(header, 5);
+        // A length whose fifth byte carries more than the four bits left over, followed by no inputs
+        const char length[] = {'\xFF', '\xFF', '\xFF', '\xFF', '\x7F', 0};
+        file.write(length, 6);
+    }
+
+    auto loaded = Replay{"Previous", 1, 0, 1u};
+    FileReader{}.readFile(loaded, "corrupt.replay");
+
+    CHECK(loaded.getMazeName() == "");
+    CHECK(loaded.getLength() == 0);
+
+    filesystem::remove("corrupt.replay");
+}
+
+TEST_CASE("A binary maze file holds the same maze as the text files it was imported from")
+{
+    auto assetManager = AssetManager{};
+    assetManager.loadLayout("layout", "Classic");
+    assetManager.loadRotationMap("rotation", "Classic");
+    assetManager.loadKeyMap("key map", "Classic");
+    assetManager.loadStartPos("startPos", "Classic");
+
+    auto mazeData = Maze::Data{};
+    mazeData.layout = assetManager.getLayout("layout");
+    mazeData.rotationMap = assetManager.getRotationMap("rotation");
+    mazeData.keyMap = assetManager.getKeyMap("key map");
+    mazeData.startPos = assetManager.getStartPos("startPos");
+
+    REQUIRE(MazeFile::write(mazeData, "test.maze"));
+
+    auto mazeFile = MazeFile{};
+    REQUIRE(mazeFile.open("test.maze"));
+
+    auto loaded = mazeFile.getData();
+    CHECK(mazeFile.getNumRows() == static_cast<int>(mazeData.layout.size()));
+    CHECK(loaded.layout == mazeData.layout);
+    CHECK(loaded.rotationMap == mazeData.rotationMap);
+    CHECK(loaded.keyMap == mazeData.keyMap);
+    CHECK(loaded.startPos == mazeData.startPos);
+    mazeFile.close();
+
+    SUBCASE("A damaged file is rejected")
+    {
+        {
+            auto file = fstream{"test.maze", fstream::in | fstream::out | fstream::binary};
+            file.seekp(40);
+            file.put('X');
+        }
+
+        CHECK_FALSE(mazeFile.open("test.maze"));
+    }
+
+    filesystem::remove("test.maze");
+}
+
+TEST_CASE("A binary maze file with positions outside the maze is rejected")
+{
+    auto mazeData = Maze::Data{};
+    mazeData.layout = {"WWW", "WKW", "WGW"};
+    mazeData.rotationMap = {"000", "000", "000"};
+    mazeData.keyMap = {{make_tuple(1, 1), {make_tuple(1, 2)}}};
+    mazeData.startPos = {sf::Vector2f{1, 1}};
+
+    auto mazeFile = MazeFile{};
+    REQUIRE(MazeFile::write(mazeData, "test.maze"));
+    REQUIRE(mazeFile.open("test.maze"));
+    mazeFile.close();
+
+    SUBCASE("A key outside the maze")
+    {
+        mazeData.keyMap = {{make_tuple(3, 1), {make_tuple(1, 2)}}};
+    }
+    SUBCASE("A gate outside the maze")
+    {
+        mazeData.keyMap = {{make_tuple(1, 1), {make_tuple(1, -1)}}};
+    }
+    SUBCASE("A start position outside the maze")
+    {
+        mazeData.startPos.push_back(sf::Vector2f{1, 3});
+    }
+    SUBCASE("A start position that is not a number")
+    {
+        mazeData.startPos.push_back(sf::Vector2f{nanf(""), 1});
+    }
+
+    REQUIRE(MazeFile::write(mazeData, "test.maze"));
+    CHECK_FALSE(mazeFile.open("test.maze"));
+
+    filesystem::remove("test.maze");
+}
+
+TEST_CASE("A binary maze file is imported again when its text files are newer")
+{
+    auto layout = vector<string>{"WWW", "WEW", "WWW"};
+    auto rotations = vector<string>{"000", "000", "000"};
+    auto mazePath = MAZE_DIRECTORY + "test"s + MAZE_FILE_EXTENSION;
+    auto layoutPath = MAZE_DIRECTORY + "test"s + "_layout.txt";
+
+    auto fileWriter = FileWriter{};
+    fileWriter.writeFile(layout, layoutPath);
+    fileWriter.writeFile(rotations, MAZE_DIRECTORY + "test"s + "_orientations.txt");
+
+    auto assetManager = AssetManager{};
+    assetManager.loadMaze("test", "test");
+
+    CHECK(MazeFile::isUpToDate("test"));
+
+    // The layout is edited by hand, after the binary file was written
+    layout[1] = "WFW";
+    fileWriter.writeFile(layout, layoutPath);
+    filesystem::last_write_time(mazePath, filesystem::last_write_time(layoutPath) - 1h);
+
+    CHECK_FALSE(MazeFile::isUpToDate("test"));
+
+    assetManager.loadMaze("test", "test");
+
+    CHECK(assetManager.getMaze("test").layout == layout);
+    CHECK(MazeFile::isUpToDate("test"));
+
+    for (auto suffix : {"_layout.txt", "_orientations.txt", MAZE_FILE_EXTENSION})
+        filesystem::remove(MAZE_DIRECTORY + "test"s + suffix);
+}
+
+TEST_CASE("Files in an asset pack are found by the paths they were packed from")
+{
+    ofstream{"test_pack_a.txt"} << "first";
+    ofstream{"test_pack_b.txt"} << "second file";
+
+    REQUIRE(AssetPack::write("test.pack", {"test_pack_b.txt", "test_pack_a.txt"}));
+
+    auto pack = AssetPack{};
+    REQUIRE(pack.open("test.pack"));
+    CHECK(pack.getNumFiles() == 2);
+
+    auto blob = pack.find("test_pack_b.txt");
+    REQUIRE(blob);
+    CHECK(string(static_cast<const char*>(blob.data), blob.size) == "second file");
+    CHECK(reinterpret_cast<uintptr_t>(blob.data) % AssetPack::BLOB_ALIGNMENT == 0);
+
+    CHECK_FALSE(pack.find("test_pack_c.txt"));
+}
+
+TEST_CASE("Replaying a level reproduces it exactly")
+{
+    auto simulation = Simulation{"Classic", 1, 42};
+    const sf::Keyboard::Key keys[] = {sf::Keyboard::Left, sf::Keyboard::Up, sf::Keyboard::Right, sf::Keyboard::Down};
+
+    for (auto i = 0; i < 40 && !simulation.isOver(); i++)
+    {
+        simulation.pressKey(keys[i % 4]);
+        simulation.step(45);
+    }
+
+    auto replay = Simulation{simulation.getReplay()};
+    replay.step(simulation.getFrameCount() + 100);
+
+    CHECK(replay.isOver());
+    CHECK(replay.getFrameCount() == simulation.getFrameCount());
+    CHECK(replay.getScore() == simulation.getScore());
+    CHECK(replay.getLivesLeft() == simulation.getLivesLeft());
+}
+
+TEST_CASE("Asset ids are resolved once and index the asset that is added later")
+{
+    auto assetManager = AssetManager{};
+
+    auto wallId = assetManager.getTextureId("wall");
+    auto gateId = assetManager.getTextureId("gate");
+
+    CHECK(wallId != gateId);
+    CHECK(assetManager.getTextureId("wall") == wallId);
+    CHECK_FALSE(assetManager.getTexture(wallId));
+
+    auto texture = make_shared<sf::Texture>();
+    assetManager.addTexture(wallId, texture);
+
+    CHECK(assetManager.getTexture(wallId) == texture);
+    CHECK(assetManager.getTexture("wall") == texture);
+    CHECK_FALSE(assetManager.getTexture(gateId));
+    CHECK(assetManager.getStatus(Song::UNRAVEL) == sf::SoundSource::Status::Stopped);
+}
+
+TEST_CASE("An asset that fails to load is reported and not stored")
+{
+    auto assetManager = AssetManager{};
+
+    assetManager.loadTexture("missing", "resources/missing.png");
+    assetManager.loadFont("missing", "resources/missing.ttf");
+    assetManager.loadSoundBuffer(Sound::KEY, "resources/missing.wav");
+
+    CHECK_FALSE(assetManager.getTexture("missing"));
+    CHECK_FALSE(assetManager.getFont("missing"));
+
+    auto failed = vector<string>{"resources/missing.png", "resources/missing.ttf", "resources/missing.wav"};
+    CHECK(assetManager.getFailedAssets() == failed);
+}
+
+TEST_CASE("Animation clips split a row of a sprite sheet into frames")
+{
+    auto texture = make_shared<sf::Texture>();
+    texture->loadFromFile(RED_POLICE);
+
+    auto clip = Animator::makeClip(texture, sf::Vector2i{32,32}, 2, 300.f);
+
+    REQUIRE(clip);
+    CHECK(clip->frames.size() == texture->getSize().x/32);
+    CHECK(clip->frames[1] == sf::IntRect(32, 64, 32, 32));
+    CHECK(clip->origin == sf::Vector2f(16,16));
+    CHECK_FALSE(Animator::makeClip(nullptr, sf::Vector2i{32,32}, 0, 300.f));
+}
+
+TEST_CASE("Enemies with different default looks share their other clips")
+{
+    auto frightened = make_shared<sf::Texture>();
+    frightened->loadFromFile(BLUE_POLICE);
+    auto red = make_shared<sf::Texture>();
+    red->loadFromFile(RED_POLICE);
+
+    auto clips = Enemy::Clips{map<string,texturePtr>{{"frightened", frightened}}};
+    auto redClips = clips.withDefault(red);
+
+    CHECK(redClips.get(Enemy::Look::FRIGHTENED, LEFT) == clips.get(Enemy::Look::FRIGHTENED, LEFT));
+    CHECK(redClips.get(Enemy::Look::DEFAULT, LEFT)->texture == red);
+    CHECK_FALSE(clips.get(Enemy::Look::DEFAULT, LEFT));
+}
+
+TEST_CASE("Path lengths through the maze count the moves along the shortest path")
+{
+    auto maze = initializeMaze();
+    auto start = maze.getPlayerStart();
+    auto tileLength = maze.getTileLength();
+
+    CHECK(maze.getPathLength(start, start) == 0);
+
+    for (auto direction : {UP, RIGHT, DOWN, LEFT})
+    {
+        if (maze.isNeighbourNode(start, direction))
+            CHECK(maze.getPathLength(start + direction*tileLength, start) == 1);
+    }
+
+    CHECK(maze.getPathLength(sf::Vector2f{-100,-100}, start) == -1);
+
+    SUBCASE("A target in a wall is moved to the nearest open node")
+    {
+        auto corner = get<0>(maze.getMazeBounds());
+        CHECK(maze.getPathLength(start, corner) > 0);
+    }
+}
+
+TEST_CASE("Paths through the maze wrap across its edges, as characters do")
+{
+    auto maze = makeMaze({"WWEWW",
+                          "EEWEE",
+                          "WWWWW",
+                          "WWEWW"});
+
+    // Through the tunnel from the left edge to the right edge
+    CHECK(maze.getPathLength(sf::Vector2f{5,15}, sf::Vector2f{35,15}) == 2);
+
+    // Through the tunnel from the bottom edge to the top edge
+    CHECK(maze.getPathLength(sf::Vector2f{25,35}, sf::Vector2f{25,5}) == 1);
+
+    // A tunnel is only used if the tiles on both sides of it are open
+    auto closedMaze = makeMaze({"EEWEW"});
+    CHECK(maze.getPathLength(sf::Vector2f{5,15}, sf::Vector2f{25,35}) == -1);
+    CHECK(closedMaze.getPathLength(sf::Vector2f{5,5}, sf::Vector2f{35,5}) == -1);
+}
+
+TEST_CASE("Path lengths are found again when a gate opens")
+{
+    auto maze = makeMaze({"EEGEW",
+                          "WWWWW",
+                          "WWWWW"});
+
+    // The top left corner is a fixed target, whose distances are found when the maze is made
+    CHECK(maze.getPathLength(sf::Vector2f{35,5}, sf::Vector2f{5,5}) == -1);
+
+    // Passable gates are still closed to paths
+    maze.setGatesPassable(true);
+    CHECK(maze.getPathLength(sf::Vector2f{35,5}, sf::Vector2f{5,5}) == -1);
+
+    maze.activate(sf::Vector2f{25,5});
+    CHECK(maze.getPathLength(sf::Vector2f{35,5}, sf::Vector2f{5,5}) == 3);
+    CHECK(maze.getPathLength(sf::Vector2f{35,5}, sf::Vector2f{15,5}) == 2);
+}
+
+TEST_CASE("Path lengths stay correct however many targets are looked up")
+{
+    auto maze = makeMaze(vector<string>(10, "EEEEEEEEEW"));
+
+    maze.setSharedTarget(sf::Vector2f{45,45});
+
+    // More targets than the maze remembers, so the first ones are forgotten and found again
+    for (auto pass = 0; pass < 2; pass++)
+    {
+        for (auto row = 0; row < 10; row++)
+        {
+            for (auto col = 0; col < 9; col++)
+            {
+                auto target = sf::Vector2f{col*10.f + 5, row*10.f + 5};
+                CHECK(maze.getPathLength(target, target) == 0);
+                CHECK(maze.getPathLength(sf::Vector2f{45,45}, target) == abs(col - 4) + min(abs(row - 4), 10 - abs(row - 4)));
+            }
+        }
+    }
+}
+
+TEST_CASE("The profiler records frames and zones and writes them as a Chrome trace")
+{
+    auto profiler = Profiler{4};
+    profiler.setEnabled(true);
+
+    CHECK(profiler.getNumFrames() == 0);
+    CHECK(profiler.getFrameTime(50) == 0);
+
+    for (auto i = 0; i < 6; i++)
+    {
+        profiler.beginFrame();
+        {
+            auto zone = Profiler::Zone{profiler, "update"};
+        }
+        profiler.endFrame();
+    }
+
+    CHECK(profiler.getNumFrames() == 4);
+    CHECK(profiler.getFrameTime(99) >= profiler.getFrameTime(50));
+    REQUIRE(profiler.writeChromeTrace("test_trace.json"));
+
+    auto file = ifstream{"test_trace.json"};
+    auto trace = string{istreambuf_iterator<char>{file}, istreambuf_iterator<char>{}};
+    CHECK(trace.find("\"traceEvents\"") != string::npos);
+    CHECK(trace.find("\"name\":\"update\"") != string::npos);
+}
+
+TEST_CASE("The frame scheduler caps the updates in a frame and drops the rest")
+{
+    auto scheduler = FrameScheduler{1.0f, 3};
+
+    scheduler.beginFrame();
+    CHECK_FALSE(scheduler.shouldUpdate());
+
+    this_thread::sleep_for(chrono::milliseconds{20});
+    scheduler.beginFrame();
+
+    auto numUpdates = 0;
+    while (scheduler.shouldUpdate())
+        numUpdates++;
+
+    CHECK(numUpdates == 3);
+    CHECK(scheduler.getDroppedSteps() >= 16);
+    CHECK(scheduler.getAlpha() >= 0.0f);
+    CHECK(scheduler.getAlpha() < 1.0f);
+}
+
+TEST_CASE("Time spent waiting for input is caught up in full rather than dropped")
+{
+    auto scheduler = FrameScheduler{1.0f, 3};
+    scheduler.beginFrame();
+
+    // The game loop waits for input after drawing an idle state's frame
+    this_thread::sleep_for(chrono::milliseconds{20});
+    scheduler.allowFullCatchUp();
+    scheduler.beginFrame();
+
+    auto numUpdates = 0;
+    while (scheduler.shouldUpdate())
+        numUpdates++;
+
+    CHECK(numUpdates >= 20);
+    CHECK(scheduler.getDroppedSteps() == 0);
+
+    // Only the frame after the wait is caught up in full
+    this_thread::sleep_for(chrono::milliseconds{20});
+    scheduler.beginFrame();
+
+    numUpdates = 0;
+    while (scheduler.shouldUpdate())
+        numUpdates++;
+
+    CHECK(numUpdates == 3);
+}
+
+TEST_CASE("Character sprites are drawn between their last two positions")
+{
+    auto maze = initializeMaze();
+    auto start = maze.getPlayerStart();
+    auto player = Player{map<string,texturePtr>{}, start, &maze};
+
+    player.savePosition();
+    player.moveCharacter(sf::Vector2f{10,0});
+
+    CHECK(player.getSprite(0.0f).getPosition() == start);
+    CHECK(player.getSprite(0.5f).getPosition() == start + sf::Vector2f(5,0));
+    CHECK(player.getSprite(1.0f).getPosition() == player.getSprite().getPosition());
+
+    SUBCASE("Teleporting is not interpolated")
+    {
+        player.savePosition();
+        player.teleport(start + sf::Vector2f(300,0));
+
+        CHECK(player.getSprite(0.5f).getPosition() == start + sf::Vector2f(300,0));
+    }
+}
+
+TEST_CASE("Copies of the maze renderer can tell when a tile has changed")
+{
+    auto maze = initializeMaze();
+    auto tileLength = maze.getTileLength();
+
+    auto position = sf::Vector2f{-1,-1};
+
+    for (auto x = tileLength/2; x < maze.getWidth(); x += tileLength)
+        for (auto y = tileLength/2; y < maze.getHeight(); y += tileLength)
+            if (maze.getTileType(sf::Vector2f{x,y}) == Maze::TileType::FRUIT)
+                position = sf::Vector2f{x,y};
+
+    REQUIRE(position.x > 0);
+
+    auto copy = maze.getRenderer();
+    maze.activate(position);
 
+    CHECK(maze.getRenderer().getRevision() == copy.getRevision() + 1);
+}
+
+TEST_CASE("The camera only scrolls along the axes on which the maze is larger than the screen area")
+{
+    auto camera = Camera{sf::FloatRect{0, 0, 100, 100}};
+
+    camera.follow(sf::Vector2f{400, 30}, sf::FloatRect{0, 0, 1000, 80});
+    CHECK(camera.getVisibleArea().left == 350);
+    CHECK(camera.getVisibleArea().top == 0);
+
+    // The camera stops at the edge of the maze
+    camera.follow(sf::Vector2f{990, 30}, sf::FloatRect{0, 0, 1000, 80});
+    CHECK(camera.getVisibleArea().left == 900);
+    CHECK(camera.isVisible(sf::FloatRect{950, 50, 10, 10}));
+    CHECK_FALSE(camera.isVisible(sf::FloatRect{10, 50, 10, 10}));
+}
+
+TEST_CASE("Only the chunks of the maze in view are drawn")
+{
+    auto maze = initializeMaze();
+    const auto& renderer = maze.getRenderer();
+    auto [topLeft, bottomRight] = maze.getMazeBounds();
+
+    CHECK(renderer.getNumVisibleChunks(sf::FloatRect{topLeft, bottomRight - topLeft}) == 4);
+    CHECK(renderer.getNumVisibleChunks(sf::FloatRect{topLeft, sf::Vector2f{40, 40}}) == 1);
+    CHECK(renderer.getNumVisibleChunks(sf::FloatRect{bottomRight + sf::Vector2f{100, 100}, sf::Vector2f{10, 10}}) == 0);
+}
+
+TEST_CASE("The enemy roster passes the maze's events on to every enemy")
+{
+    auto maze = initializeMaze();
+    auto player = Player{map<string,texturePtr>{}, maze.getPlayerStart(), &maze};
+
+    auto roster = EnemyRoster{};
+    for (auto i = 0; i < 8; i++)
+        roster.add(make_unique<Blinky>(Enemy::Clips{}, maze.getEnemyStarts()[0], &player, &maze));
+
+    roster.onNotify(Observer::Event::POWER_PELLET_EATEN);
+
+    CHECK(roster.size() == 8);
+    for (auto& enemy : roster.getEnemies())
+        CHECK(enemy->isFrightened());
+}
+
+TEST_CASE("The enemy roster records each enemy's update as a zone named after it")
+{
+    auto maze = initializeMaze();
+    auto player = Player{map<string,texturePtr>{}, maze.getPlayerStart(), &maze};
+
+    auto roster = EnemyRoster{};
+    roster.add(make_unique<Blinky>(Enemy::Clips{}, maze.getEnemyStarts()[0], &player, &maze));
+    roster.add(make_unique<Pinky>(Enemy::Clips{}, maze.getEnemyStarts()[1], &player, &maze));
+
+    auto profiler = Profiler{4};
+    profiler.setEnabled(true);
+    profiler.beginFrame();
+    roster.update(MS_PER_FRAME, profiler);
+    profiler.endFrame();
+
+    REQUIRE(profiler.writeChromeTrace("test_trace.json"));
+
+    auto file = ifstream{"test_trace.json"};
+    auto trace = string{istreambuf_iterator<char>{file}, istreambuf_iterator<char>{}};
+    CHECK(trace.find("\"name\":\"Blinky\"") != string::npos);
+    CHECK(trace.find("\"name\":\"Pinky\"") != string::npos);
+}
+
+TEST_CASE("A large roster moves each of its enemies exactly as the enemy would move on its own")
+{
+    auto maze = initializeMaze();
+    auto player = Player{map<string,texturePtr>{}, maze.getPlayerStart(), &maze};
+    auto starts = maze.getEnemyStarts();
+    auto profiler = Profiler{1};
+
+    const auto numEnemies = 100;
+    auto roster = EnemyRoster{};
+    auto loners = vector<unique_ptr<Enemy>>{};
+
+    for (auto i = 0; i < numEnemies; i++)
+    {
+        roster.add(make_unique<Blinky>(Enemy::Clips{}, starts[i % starts.size()], &player, &maze)).seedRandom(i);
+        loners.push_back(make_unique<Blinky>(Enemy::Clips{}, starts[i % starts.size()], &player, &maze));
+        loners.back()->seedRandom(i);
+    }
+
+    // Long enough to change between scatter and chase, and to be frightened part of the way through
+    for (auto tick = 0; tick < 1000; tick++)
+    {
+        if (tick == 500)
+        {
+            roster.onNotify(Observer::Event::POWER_PELLET_EATEN);
+            for (auto& loner : loners)
+                loner->onNotify(Observer::Event::POWER_PELLET_EATEN);
+        }
+
+        roster.update(MS_PER_FRAME, profiler);
+        for (auto& loner : loners)
+            loner->update(MS_PER_FRAME);
+    }
+
+    REQUIRE(roster.size() == numEnemies);
+    CHECK(roster[0].getPosition() != starts[0]);
+
+    for (auto i = 0; i < numEnemies; i++)
+    {
+        CHECK(roster[i].getPosition() == loners[i]->getPosition());
+        CHECK(roster[i].currentDir() == loners[i]->currentDir());
+    }
+}
+
+TEST_CASE("A sprite batch needs one draw call for each texture")
+{
+    auto red = sf::Texture{};
+    auto blue = sf::Texture{};
+    auto batch = SpriteBatch{};
+
+    for (auto i = 0; i < 50; i++)
+    {
+        batch.add(sf::Sprite{red});
+        batch.add(sf::Sprite{blue});
+    }
+    CHECK(batch.getNumDrawCalls() == 2);
+
+    batch.clear();
+    batch.add(sf::Sprite{red});
+    CHECK(batch.getNumDrawCalls() == 1);
+}
+
+TEST_CASE("The collision grid finds characters whose paths cross, however fast they move")
+{
+    auto grid = CollisionGrid{sf::Vector2f{0,0}, 10};
+    auto nearby = vector<int>{};
+
+    // Enemy 0 swaps tiles with the player in one update, enemy 1 is far away
+    grid.add(0, sf::Vector2f{25,5}, sf::Vector2f{5,5});
+    grid.add(1, sf::Vector2f{95,95}, sf::Vector2f{85,95});
+    grid.query(sf::Vector2f{5,5}, sf::Vector2f{25,5}, nearby);
+
+    REQUIRE(nearby.size() == 1);
+    CHECK(nearby[0] == 0);
+    CHECK(CollisionGrid::isSweptCollision(sf::Vector2f{5,5}, sf::Vector2f{25,5}, sf::Vector2f{25,5}, sf::Vector2f{5,5}, 5));
+
+    // Moving one after the other along the same row is not a collision
+    CHECK_FALSE(CollisionGrid::isSweptCollision(sf::Vector2f{5,5}, sf::Vector2f{25,5}, sf::Vector2f{35,5}, sf::Vector2f{55,5}, 5));
+}
+
+TEST_CASE("Each character state is made once and appears on the stack at most once")
+{
+    auto maze = initializeMaze();
+    auto player = Player{map<string,texturePtr>{}, maze.getPlayerStart(), &maze};
+    auto blinky = Blinky{Enemy::Clips{}, maze.getEnemyStarts()[0], &player, &maze};
+    auto states = CharacterStateStack{};
+
+    auto scatter = states.get<EnemyScatterState>(&blinky, &maze);
+    auto chase = states.get<EnemyChaseState>(&blinky, &maze);
+    CHECK(states.get<EnemyScatterState>(&blinky, &maze) == scatter);
+
+    // Scatter and chase alternate many times during a level
+    for (auto i = 0; i < 100; i++)
+    {
+        states.push(scatter);
+        states.push(chase);
+    }
+    CHECK(states.size() == 2);
+    CHECK(states.top() == chase);
+
+    states.pop();
+    CHECK(states.top() == scatter);
+
+    // A copy of the stack is empty, since its states belong to another character
+    auto copy = states;
+    CHECK(copy.empty());
+}
+
+TEST_CASE("An enemy that recovers from fright after being eaten does not return to its pen")
+{
+    auto maze = initializeMaze();
+    auto player = Player{map<string,texturePtr>{}, maze.getPlayerStart(), &maze};
+    auto blinky = Blinky{Enemy::Clips{}, maze.getEnemyStarts()[0], &player, &maze};
+
+    // Eaten in its pen, so that it is back there on the next update
+    blinky.update(MS_PER_FRAME);
+    blinky.FrightenedMode();
+    blinky.die();
+    blinky.update(MS_PER_FRAME);
+    CHECK_FALSE(blinky.isInteractive());
+
+    // It leaves the pen for scatter mode
+    while (!blinky.isInteractive())
+        blinky.update(MS_PER_FRAME);
+    blinky.update(MS_PER_FRAME);
+
+    blinky.FrightenedMode();
+    while (blinky.isFrightened())
+        blinky.update(MS_PER_FRAME);
+
+    // The pen's timer ran out long ago, so uncovering it would make the enemy uncatchable for an update
+    blinky.update(MS_PER_FRAME);
+    CHECK(blinky.isInteractive());
+}
+
+TEST_CASE("A button's revision only changes when its appearance does")
+{
+    auto button = Button{make_shared<sf::Texture>()};
+    auto revision = button.getRevision();
+
+    button.setPosition(100.f, 200.f);
+    CHECK(button.getRevision() > revision);
+    revision = button.getRevision();
+
+    // Menus set the same position and hover colour every frame, which should not make their render layers out of date
+    button.setPosition(sf::Vector2f{100.f, 200.f});
+    button.setHoverColour(sf::Color::Red);
+    CHECK(button.getRevision() == revision);
+
+    button.setSpriteScale(0.5f, 0.5f);
+    CHECK(button.getRevision() > revision);
+}